@@ -26,6 +26,7 @@ class VerticalLiftBridgeController {
     let c = '#e5e7eb';
     if (t === 'OPENING') c = '#22c55e';
     else if (t === 'CLOSING') c = '#ef4444';
+    else if (t === 'FAULT') c = '#dc2626';
     else if (t === 'BOAT_WARNING' || t === 'ROAD_WARNING') c = '#f59e0b';
     st.style.color = c;
   }
@@ -11,24 +11,47 @@ document.addEventListener('DOMContentLoaded', () => {
   const STATE_ENDPOINT   = `${baseURL}/state`;
   const LIGHTS_ENDPOINT  = `${baseURL}/lights`;
   const TIMERS_ENDPOINT  = `${baseURL}/timers`;
+  const CMD_ENDPOINT     = `${baseURL}/cmd`;
+  const RESET_ENDPOINT   = '/estop/reset';
 
-  function sendRequest(endpoint, opts = {}) {
-    return fetch(`${baseURL}${endpoint}`, opts)
-      .then(res => res.text())
-      .then(text => {
+  async function sendRequest(endpoint, opts = {}) {
+    try {
+      const r = await fetch(`${baseURL}${endpoint}`, opts);
+      const text = await r.text();
+      let data = null;
+      try { data = JSON.parse(text); } catch {}
+      if (!data || typeof data.seq !== 'number') {
         if (statusEl) statusEl.textContent = `Status: ${text}`;
         return text;
-      })
-      .catch(err => {
-        console.error(err);
-        if (statusEl) statusEl.textContent = 'Status: Error';
-      });
+      }
+      // Commands are queued; show the result once the controller applied it
+      if (statusEl) statusEl.textContent = `Status: ${data.status} (queued #${data.seq})`;
+      await waitForCommand(data.seq);
+      if (statusEl) statusEl.textContent = `Status: ${data.status}`;
+      return data.status;
+    } catch (err) {
+      console.error(err);
+      if (statusEl) statusEl.textContent = 'Status: Error';
+    }
+  }
+
+  async function waitForCommand(seq, timeoutMs = 3000) {
+    const deadline = Date.now() + timeoutMs;
+    while (Date.now() < deadline) {
+      try {
+        const r = await fetch(`${CMD_ENDPOINT}?seq=${seq}`, { cache: 'no-store' });
+        if (r.ok && (await r.json()).done) return true;
+      } catch {}
+      await new Promise(res => setTimeout(res, 100));
+    }
+    return false;
   }
 
   const modeSwitch = document.getElementById('modeSwitch');
   const modeLabel  = document.getElementById('modeLabel');
   const btnOpen    = document.getElementById('Open');
   const btnClose   = document.getElementById('Close');
+  const btnReset   = document.getElementById('Reset');
   const boatDistA  = document.getElementById('boatDistA');
   const boatDistB  = document.getElementById('boatDistB');
 
@@ -55,6 +78,7 @@ document.addEventListener('DOMContentLoaded', () => {
   initMode().then(() => {
     if (btnOpen)  btnOpen.addEventListener('click', onOpen);
     if (btnClose) btnClose.addEventListener('click', onClose);
+    if (btnReset) btnReset.addEventListener('click', onReset);
   });
 
   async function initMode() {
@@ -108,6 +132,12 @@ document.addEventListener('DOMContentLoaded', () => {
     await sendRequest(CLOSE_ENDPOINT);
   }
 
+  // An e-stop holds FAULT until reset; the controller answers 409 while the
+  // button is still pressed, and that text ends up in the status line
+  async function onReset() {
+    await sendRequest(RESET_ENDPOINT, { method: 'POST' });
+  }
+
   // ===== Distances A & B =====
   function startDistancePolling() {
     const poll = async () => {
@@ -128,80 +158,89 @@ document.addEventListener('DOMContentLoaded', () => {
     setInterval(poll, 500);
   }
 
-  // ===== Bridge state =====
-  function startStatePolling() {
+  // Long-poll a versioned status route: answers at once when something changed
+  // since the last version we saw, otherwise the controller holds the request
+  // until it does (or answers 304 after the wait).
+  function watch(endpoint, onData, gapMs) {
+    let version = null;
     const poll = async () => {
       try {
-        const r = await fetch(STATE_ENDPOINT, { cache: 'no-store' });
-        if (!r.ok) throw new Error('bad response');
-        const data = await r.json();
-        const s = typeof data.state === 'string' ? data.state : 'IDLE';
-        bridge.setStateText?.(s);
-        // timers are handled by /timers now
-      } catch {}
+        const url = version === null ? endpoint : `${endpoint}?since=${version}&wait=20000`;
+        const r = await fetch(url, { cache: 'no-store' });
+        if (r.status === 200) {
+          const data = await r.json();
+          if (typeof data.version === 'number') version = data.version;
+          onData(data);
+        } else if (r.status !== 304) {
+          throw new Error('bad response');
+        }
+      } catch (e) {
+        version = null;
+        await new Promise(res => setTimeout(res, 1000));
+      }
+      setTimeout(poll, gapMs);
     };
     poll();
-    setInterval(poll, 350);
+  }
+
+  // ===== Bridge state =====
+  function startStatePolling() {
+    watch(STATE_ENDPOINT, data => {
+      const s = typeof data.state === 'string' ? data.state : 'IDLE';
+      bridge.setStateText?.(s);
+      if (btnReset) btnReset.hidden = s !== 'FAULT';
+      // timers are handled by /timers now
+    }, 100);
   }
 
   // ===== Lights mirror =====
-  function setLamp(el, on) {
+  // v is the lamp's pattern: 0 / 1 steady, or [period_ms, on_ms] flashing.
+  // A flash is animated here from the same numbers the LEDC runs on.
+  function setLamp(el, v) {
     if (!el) return;
-    if (on) el.classList.add('on');
-    else    el.classList.remove('on');
+    const key = JSON.stringify(v ?? 0);
+    if (el.dataset.pattern === key) return; // leave a running flash alone
+    el.dataset.pattern = key;
+    el.getAnimations?.().forEach(a => a.cancel());
+    el.classList.toggle('on', Array.isArray(v) || !!v);
+    if (Array.isArray(v) && v[0] > 0 && el.animate) {
+      el.animate([
+        { opacity: 1, offset: 0 },
+        { opacity: 0.2, offset: Math.min(1, v[1] / v[0]) },
+        { opacity: 0.2, offset: 1 }
+      ], { duration: v[0], iterations: Infinity, easing: 'step-end' });
+    }
   }
 
   function startLightsPolling() {
-    const poll = async () => {
-      try {
-        const r = await fetch(LIGHTS_ENDPOINT, { cache: 'no-store' });
-        if (!r.ok) throw new Error('bad response');
-        const data = await r.json();
-        setLamp(road.red,    !!data.road?.red);
-        setLamp(road.yellow, !!data.road?.yellow);
-        setLamp(road.green,  !!data.road?.green);
-        setLamp(ship.red,    !!data.boat?.red);
-        setLamp(ship.yellow, !!data.boat?.yellow);
-        setLamp(ship.green,  !!data.boat?.green);
-      } catch (e) {
-        // ignore
-      }
-    };
-    poll();
-    setInterval(poll, 250);
+    watch(LIGHTS_ENDPOINT, data => {
+      setLamp(road.red,    data.road?.red);
+      setLamp(road.yellow, data.road?.yellow);
+      setLamp(road.green,  data.road?.green);
+      setLamp(ship.red,    data.boat?.red);
+      setLamp(ship.yellow, data.boat?.yellow);
+      setLamp(ship.green,  data.boat?.green);
+    }, 100);
   }
 
   // ===== Timers (link ESP32 timing to timer chips) =====
   function startTimerPolling() {
-    const poll = async () => {
-      try {
-        const r = await fetch(TIMERS_ENDPOINT, { cache: 'no-store' });
-        if (!r.ok) throw new Error('bad response');
-        const data = await r.json();
-
-        const roadMs = (data.road && typeof data.road.remaining_ms === 'number')
-          ? data.road.remaining_ms
-          : 0;
-        const boatMs = (data.boat && typeof data.boat.remaining_ms === 'number')
-          ? data.boat.remaining_ms
-          : 0;
-
-        if (road.timer) {
-          road.timer.textContent =
-            roadMs > 0 ? (roadMs / 1000).toFixed(1) + 's' : '—';
-        }
-        if (ship.timer) {
-          ship.timer.textContent =
-            boatMs > 0 ? (boatMs / 1000).toFixed(1) + 's' : '—';
-        }
-      } catch (e) {
-        // Optionally clear timers on error
-        // if (road.timer) road.timer.textContent = '—';
-        // if (ship.timer) ship.timer.textContent = '—';
+    watch(TIMERS_ENDPOINT, data => {
+      const roadMs = (data.road && typeof data.road.remaining_ms === 'number')
+        ? data.road.remaining_ms
+        : 0;
+      const boatMs = (data.boat && typeof data.boat.remaining_ms === 'number')
+        ? data.boat.remaining_ms
+        : 0;
+
+      if (road.timer) {
+        road.timer.textContent =
+          roadMs > 0 ? (roadMs / 1000).toFixed(1) + 's' : '—';
       }
-    };
-
-    poll();
-    setInterval(poll, 200);
+      if (ship.timer) {
+        ship.timer.textContent =
+          boatMs > 0 ? (boatMs / 1000).toFixed(1) + 's' : '—';
+      }
+    }, 200);
   }
 });
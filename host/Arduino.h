@@ -0,0 +1,408 @@
+// Host stand-in for the parts of the Arduino-ESP32 core used by src/main.cpp.
+// Lets the firmware compile and run unmodified on Linux for load tests,
+// simulators and benchmarks. Not a general purpose Arduino emulator.
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <cstdarg>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <ctime>
+#include <functional>
+#include <string>
+#include <thread>
+
+#include <unistd.h>
+
+#define BRIDGE_HOST 1
+
+#define HIGH 1
+#define LOW 0
+#define INPUT 0x01
+#define OUTPUT 0x03
+#define INPUT_PULLUP 0x05
+#define RISING 0x01
+#define FALLING 0x02
+#define CHANGE 0x03
+
+#define IRAM_ATTR
+#define RTC_DATA_ATTR
+// RTC_NOINIT_ATTR variables share one section, so a reset simulator can
+// carry them into the next boot (tools/reset_check.cpp)
+#define RTC_NOINIT_ATTR __attribute__((section("rtc_noinit")))
+#define PROGMEM
+
+typedef uint8_t byte;
+
+// ---------------------------------------------------------------- clock
+// Real time by default. Simulators switch to virtual time, where delay()
+// and pulseIn() advance the clock instead of sleeping.
+inline std::atomic<bool> hostVirtualTime(false);
+inline std::atomic<uint64_t> hostVirtualUs(0);
+inline const std::chrono::steady_clock::time_point hostEpoch = std::chrono::steady_clock::now();
+
+inline uint64_t hostMicros64()
+{
+  if (hostVirtualTime.load(std::memory_order_relaxed))
+    return hostVirtualUs.load(std::memory_order_relaxed);
+  return (uint64_t)std::chrono::duration_cast<std::chrono::microseconds>(
+             std::chrono::steady_clock::now() - hostEpoch)
+      .count();
+}
+
+inline void hostAdvanceUs(uint64_t us)
+{
+  if (hostVirtualTime.load(std::memory_order_relaxed))
+    hostVirtualUs.fetch_add(us, std::memory_order_relaxed);
+  else
+    std::this_thread::sleep_for(std::chrono::microseconds(us));
+}
+
+inline unsigned long millis() { return (unsigned long)(hostMicros64() / 1000); }
+inline unsigned long micros() { return (unsigned long)hostMicros64(); }
+inline int64_t esp_timer_get_time() { return (int64_t)hostMicros64(); }
+inline void delay(unsigned long ms) { hostAdvanceUs((uint64_t)ms * 1000); }
+inline void delayMicroseconds(unsigned int us) { hostAdvanceUs(us); }
+inline void yield() { std::this_thread::yield(); }
+
+// The host's time() is already the system wall clock: nothing to sync
+inline void configTime(long gmtOffsetSec, int daylightOffsetSec, const char *server1)
+{
+  (void)gmtOffsetSec, (void)daylightOffsetSec, (void)server1;
+}
+
+// ---------------------------------------------------------------- GPIO
+const int HOST_PIN_COUNT = 40;
+inline std::atomic<uint8_t> hostPinLevel[HOST_PIN_COUNT];
+inline std::atomic<uint8_t> hostPinMode[HOST_PIN_COUNT];
+
+// Simulated echo: returns the echo pulse width in us for echoPin, 0 for none
+inline std::function<unsigned long(int echoPin)> hostEchoModel;
+
+inline void pinMode(uint8_t pin, uint8_t mode)
+{
+  if (pin >= HOST_PIN_COUNT)
+    return;
+  hostPinMode[pin].store(mode, std::memory_order_relaxed);
+  if (mode == INPUT_PULLUP)
+    hostPinLevel[pin].store(HIGH, std::memory_order_relaxed);
+}
+
+inline void digitalWrite(uint8_t pin, uint8_t val)
+{
+  if (pin < HOST_PIN_COUNT)
+    hostPinLevel[pin].store(val ? HIGH : LOW, std::memory_order_relaxed);
+}
+
+inline int digitalRead(uint8_t pin)
+{
+  return pin < HOST_PIN_COUNT ? hostPinLevel[pin].load(std::memory_order_relaxed) : LOW;
+}
+
+// Pin interrupts. hostSetInput() drives an input pin from outside and runs
+// the handler on the calling thread, the way an ISR preempts whatever the
+// core was doing.
+inline void (*hostIsr[HOST_PIN_COUNT])();
+inline uint8_t hostIsrMode[HOST_PIN_COUNT];
+
+#define digitalPinToInterrupt(p) (p)
+inline void attachInterrupt(uint8_t pin, void (*fn)(), int mode)
+{
+  if (pin < HOST_PIN_COUNT)
+    hostIsr[pin] = fn, hostIsrMode[pin] = (uint8_t)mode;
+}
+inline void detachInterrupt(uint8_t pin)
+{
+  if (pin < HOST_PIN_COUNT)
+    hostIsr[pin] = nullptr;
+}
+
+inline void hostSetInput(uint8_t pin, uint8_t level)
+{
+  if (pin >= HOST_PIN_COUNT)
+    return;
+  uint8_t old = hostPinLevel[pin].exchange(level ? HIGH : LOW);
+  uint8_t m = hostIsrMode[pin];
+  bool fire = old != level && ((m == CHANGE) || (m == FALLING && !level) || (m == RISING && level));
+  if (fire && hostIsr[pin])
+    hostIsr[pin]();
+}
+
+// Blocks (or advances virtual time) for the echo, or the whole timeout when
+// nothing answers, just like the real thing.
+inline unsigned long pulseIn(uint8_t pin, uint8_t state, unsigned long timeout = 1000000UL)
+{
+  (void)state;
+  unsigned long us = hostEchoModel ? hostEchoModel(pin) : 0;
+  if (us == 0 || us > timeout)
+  {
+    hostAdvanceUs(timeout);
+    return 0;
+  }
+  hostAdvanceUs(us);
+  return us;
+}
+
+// ---------------------------------------------------------------- LEDC
+const int HOST_LEDC_CHANNELS = 16;
+inline std::atomic<uint32_t> hostLedcDuty[HOST_LEDC_CHANNELS];
+inline std::atomic<uint32_t> hostLedcFreq[HOST_LEDC_CHANNELS];
+inline std::atomic<int8_t> hostLedcPin[HOST_LEDC_CHANNELS];
+
+// The timer takes whole hertz, as ledc_timer_config() does; 0 means it failed
+inline double ledcSetup(uint8_t chan, double freq, uint8_t bits)
+{
+  (void)bits;
+  if (chan >= HOST_LEDC_CHANNELS || (uint32_t)freq == 0)
+    return 0;
+  hostLedcFreq[chan].store((uint32_t)freq, std::memory_order_relaxed);
+  return (uint32_t)freq;
+}
+inline void ledcAttachPin(uint8_t pin, uint8_t chan)
+{
+  if (chan < HOST_LEDC_CHANNELS)
+    hostLedcPin[chan].store((int8_t)pin, std::memory_order_relaxed);
+}
+inline void ledcDetachPin(uint8_t pin)
+{
+  for (int c = 0; c < HOST_LEDC_CHANNELS; c++)
+    if (hostLedcPin[c].load(std::memory_order_relaxed) == (int8_t)pin)
+      hostLedcPin[c].store(-1, std::memory_order_relaxed);
+}
+inline void ledcWrite(uint8_t chan, uint32_t duty)
+{
+  if (chan < HOST_LEDC_CHANNELS)
+    hostLedcDuty[chan].store(duty, std::memory_order_relaxed);
+}
+
+// What a register write routing the pin back to plain GPIO, low, does
+inline void hostGpioForceLow(uint8_t pin)
+{
+  ledcDetachPin(pin);
+  digitalWrite(pin, LOW);
+}
+
+template <typename T, typename L, typename H>
+inline T constrain(T x, L lo, H hi)
+{
+  return x < (T)lo ? (T)lo : (x > (T)hi ? (T)hi : x);
+}
+
+// ---------------------------------------------------------------- String
+class String
+{
+public:
+  String() {}
+  String(const char *s) : s_(s ? s : "") {}
+  String(const std::string &s) : s_(s) {}
+  explicit String(char c) : s_(1, c) {}
+  String(int v, unsigned char base = 10) : s_(fmtInt((long long)v, base)) {}
+  String(unsigned int v, unsigned char base = 10) : s_(fmtInt((long long)v, base)) {}
+  String(long v, unsigned char base = 10) : s_(fmtInt((long long)v, base)) {}
+  String(unsigned long v, unsigned char base = 10) : s_(fmtInt((long long)v, base)) {}
+  String(float v, unsigned int decimals = 2) : s_(fmtFloat(v, decimals)) {}
+  String(double v, unsigned int decimals = 2) : s_(fmtFloat(v, decimals)) {}
+
+  const char *c_str() const { return s_.c_str(); }
+  unsigned int length() const { return (unsigned int)s_.size(); }
+  bool reserve(unsigned int n)
+  {
+    s_.reserve(n);
+    return true;
+  }
+  void toLowerCase()
+  {
+    for (auto &c : s_)
+      c = (char)tolower((unsigned char)c);
+  }
+  long toInt() const { return strtol(s_.c_str(), nullptr, 10); }
+  float toFloat() const { return strtof(s_.c_str(), nullptr); }
+  int indexOf(char c, unsigned int from = 0) const
+  {
+    size_t i = s_.find(c, from);
+    return i == std::string::npos ? -1 : (int)i;
+  }
+  int indexOf(const char *t, unsigned int from = 0) const
+  {
+    size_t i = s_.find(t, from);
+    return i == std::string::npos ? -1 : (int)i;
+  }
+  String substring(unsigned int from) const { return from < s_.size() ? String(s_.substr(from)) : String(); }
+  String substring(unsigned int from, unsigned int to) const
+  {
+    return from < s_.size() && to > from ? String(s_.substr(from, to - from)) : String();
+  }
+  bool startsWith(const char *p) const { return s_.compare(0, strlen(p), p) == 0; }
+  bool startsWith(const String &p) const { return startsWith(p.c_str()); }
+  char operator[](unsigned int i) const { return i < s_.size() ? s_[i] : 0; }
+  bool equals(const char *o) const { return s_ == o; }
+
+  bool concat(const char *p, unsigned int n)
+  {
+    s_.append(p, n);
+    return true;
+  }
+  String &operator+=(const String &o)
+  {
+    s_ += o.s_;
+    return *this;
+  }
+  String &operator+=(const char *o)
+  {
+    s_ += o;
+    return *this;
+  }
+  String &operator+=(char c)
+  {
+    s_ += c;
+    return *this;
+  }
+  template <typename T>
+  String &operator+=(T v)
+  {
+    s_ += String(v).s_;
+    return *this;
+  }
+
+  friend bool operator==(const String &a, const String &b) { return a.s_ == b.s_; }
+  friend bool operator==(const String &a, const char *b) { return a.s_ == b; }
+  friend bool operator!=(const String &a, const char *b) { return a.s_ != b; }
+
+  friend String operator+(const String &a, const String &b) { return String(a.s_ + b.s_); }
+  friend String operator+(const String &a, const char *b) { return String(a.s_ + b); }
+  friend String operator+(const char *a, const String &b) { return String(a + b.s_); }
+  friend String operator+(const String &a, char c) { return String(a.s_ + c); }
+  template <typename T, typename = typename std::enable_if<std::is_arithmetic<T>::value>::type>
+  friend String operator+(const String &a, T v) { return String(a.s_ + String(v).s_); }
+
+  const std::string &str() const { return s_; }
+
+private:
+  static std::string fmtInt(long long v, unsigned char base)
+  {
+    if (base == 10)
+      return std::to_string(v);
+    char buf[72];
+    char *p = buf + sizeof(buf) - 1;
+    *p = 0;
+    unsigned long long u = (unsigned long long)v;
+    do
+    {
+      *--p = "0123456789abcdef"[u % base];
+      u /= base;
+    } while (u);
+    return p;
+  }
+  static std::string fmtFloat(double v, unsigned int decimals)
+  {
+    char buf[48];
+    snprintf(buf, sizeof(buf), "%.*f", (int)decimals, v);
+    return buf;
+  }
+
+  std::string s_;
+};
+
+// ---------------------------------------------------------------- Serial
+inline std::atomic<bool> hostSerialQuiet(false);
+
+class HostSerial
+{
+public:
+  void begin(unsigned long) {}
+  template <typename T>
+  void print(const T &v) { out(String(v).c_str()); }
+  void print(const char *s) { out(s); }
+  void print(const String &s) { out(s.c_str()); }
+  void print(char c)
+  {
+    char b[2] = {c, 0};
+    out(b);
+  }
+  template <typename T>
+  void println(const T &v)
+  {
+    print(v);
+    out("\n");
+  }
+  void println() { out("\n"); }
+  void printf(const char *fmt, ...)
+  {
+    if (hostSerialQuiet.load(std::memory_order_relaxed))
+      return;
+    va_list ap;
+    va_start(ap, fmt);
+    vfprintf(stderr, fmt, ap);
+    va_end(ap);
+  }
+  size_t write(const uint8_t *p, size_t n)
+  {
+    if (!hostSerialQuiet.load(std::memory_order_relaxed))
+      fwrite(p, 1, n, stderr);
+    return n;
+  }
+  int available() { return 0; }
+  int read() { return -1; }
+
+private:
+  void out(const char *s)
+  {
+    if (!hostSerialQuiet.load(std::memory_order_relaxed))
+      fputs(s, stderr);
+  }
+};
+inline HostSerial Serial;
+
+// ---------------------------------------------------------------- ESP
+// The loop task runs on core 1 as on the board; the web server thread sets 0
+inline thread_local int hostCoreId = 1;
+inline int xPortGetCoreID() { return hostCoreId; }
+
+// ---------------------------------------------------------------- tasks
+// A FreeRTOS task is a detached thread that reports the core it was pinned
+// to. Task functions never return, as on the board.
+typedef void *TaskHandle_t;
+typedef int BaseType_t;
+typedef unsigned UBaseType_t;
+#define pdPASS 1
+
+inline BaseType_t xTaskCreatePinnedToCore(void (*fn)(void *), const char *name, uint32_t stackDepth, void *arg,
+                                          UBaseType_t priority, TaskHandle_t *handle, int core)
+{
+  (void)name, (void)stackDepth, (void)priority;
+  std::thread([fn, arg, core] {
+    hostCoreId = core;
+    fn(arg);
+  }).detach();
+  if (handle)
+    *handle = nullptr;
+  return pdPASS;
+}
+
+class HostEsp
+{
+public:
+  [[noreturn]] void restart()
+  {
+    fprintf(stderr, "[host] ESP.restart()\n");
+    exit(3);
+  }
+  uint32_t getCycleCount() { return (uint32_t)(hostMicros64() * 240); }
+  uint32_t getFreeHeap() { return 200 * 1024; }
+  uint32_t getCpuFreqMHz() { return 240; }
+  // Locally administered MAC, unique per process (MAC byte 0 in the low byte)
+  uint64_t getEfuseMac() { return 0x02 | (uint64_t)(uint32_t)getpid() << 16; }
+};
+inline HostEsp ESP;
+
+// Hardware RNG on the board; anything that differs per run will do here
+inline uint32_t esp_random()
+{
+  return (uint32_t)getpid() * 2654435761u ^
+         (uint32_t)std::chrono::steady_clock::now().time_since_epoch().count();
+}
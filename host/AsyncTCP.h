@@ -0,0 +1,2 @@
+// Host stand-in: the TCP side lives in ESPAsyncWebServer.h
+#pragma once
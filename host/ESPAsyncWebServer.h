@@ -0,0 +1,526 @@
+// Host stand-in for ESPAsyncWebServer. Serves the routes registered by
+// setupRoutes() over a real TCP socket on localhost so the firmware's HTTP
+// surface can be driven by curl, a browser or tools/loadgen.cpp.
+//
+// It mirrors the behaviour that matters for performance work on the device:
+//  - one network thread runs every handler (the async_tcp task),
+//  - one request per connection (the library answers Connection: close),
+//  - callback responses returning RESPONSE_TRY_AGAIN are retried on the
+//    connection poll interval (lwIP polls every 500 ms on the ESP32).
+#pragma once
+
+#include "Arduino.h"
+#include "AsyncTCP.h"
+
+#include <arpa/inet.h>
+#include <fcntl.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <poll.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+#include <memory>
+#include <sstream>
+#include <vector>
+
+typedef enum
+{
+  HTTP_GET = 0b00000001,
+  HTTP_POST = 0b00000010,
+  HTTP_DELETE = 0b00000100,
+  HTTP_PUT = 0b00001000,
+  HTTP_PATCH = 0b00010000,
+  HTTP_HEAD = 0b00100000,
+  HTTP_OPTIONS = 0b01000000,
+  HTTP_ANY = 0b01111111,
+} WebRequestMethod;
+typedef uint8_t WebRequestMethodComposite;
+
+#define RESPONSE_TRY_AGAIN 0xFFFFFFFF
+
+typedef std::function<size_t(uint8_t *buffer, size_t maxLen, size_t index)> AwsResponseFiller;
+
+inline std::atomic<int> hostHttpPort(8080);
+inline std::atomic<int> hostTcpPollMs(500);
+
+class AsyncWebParameter
+{
+public:
+  AsyncWebParameter(const String &n, const String &v, bool post) : name_(n), value_(v), post_(post) {}
+  const String &name() const { return name_; }
+  const String &value() const { return value_; }
+  bool isPost() const { return post_; }
+
+private:
+  String name_, value_;
+  bool post_;
+};
+
+class AsyncWebHeader
+{
+public:
+  AsyncWebHeader(const String &n, const String &v) : name_(n), value_(v) {}
+  const String &name() const { return name_; }
+  const String &value() const { return value_; }
+
+private:
+  String name_, value_;
+};
+
+class AsyncWebServerResponse
+{
+public:
+  void addHeader(const String &name, const String &value) { headers.push_back({name, value}); }
+  void setCode(int c) { code = c; }
+  void setContentLength(size_t n) { contentLength = n; }
+
+  int code = 200;
+  String contentType;
+  std::vector<std::pair<String, String>> headers;
+  std::string body;
+  AwsResponseFiller filler;  // set for callback / chunked responses
+  bool chunked = false;
+  size_t contentLength = 0;  // callback responses with a known length
+};
+
+class DefaultHeaders
+{
+public:
+  static DefaultHeaders &Instance()
+  {
+    static DefaultHeaders h;
+    return h;
+  }
+  void addHeader(const String &name, const String &value) { headers.push_back({name, value}); }
+  std::vector<std::pair<String, String>> headers;
+};
+
+class AsyncWebServerRequest
+{
+public:
+  WebRequestMethodComposite method() const { return method_; }
+  const String &url() const { return url_; }
+
+  bool hasParam(const String &name, bool post = false) const { return getParam(name, post) != nullptr; }
+  const AsyncWebParameter *getParam(const String &name, bool post = false) const
+  {
+    for (auto &p : params_)
+      if (p.name() == name && p.isPost() == post)
+        return &p;
+    return nullptr;
+  }
+  size_t params() const { return params_.size(); }
+  const AsyncWebParameter *getParam(size_t i) const { return i < params_.size() ? &params_[i] : nullptr; }
+
+  bool hasHeader(const String &name) const { return getHeader(name) != nullptr; }
+  const AsyncWebHeader *getHeader(const String &name) const
+  {
+    for (auto &h : headers_)
+      if (strcasecmp(h.name().c_str(), name.c_str()) == 0)
+        return &h;
+    return nullptr;
+  }
+
+  AsyncWebServerResponse *beginResponse(int code, const String &type = String(), const String &content = String())
+  {
+    auto *r = new AsyncWebServerResponse();
+    r->code = code;
+    r->contentType = type;
+    r->body = content.str();
+    return r;
+  }
+  AsyncWebServerResponse *beginResponse_P(int code, const String &type, const uint8_t *content, size_t len)
+  {
+    auto *r = new AsyncWebServerResponse();
+    r->code = code;
+    r->contentType = type;
+    r->body.assign((const char *)content, len);
+    return r;
+  }
+  AsyncWebServerResponse *beginResponse(const String &type, size_t len, AwsResponseFiller filler)
+  {
+    auto *r = new AsyncWebServerResponse();
+    r->contentType = type;
+    r->contentLength = len;
+    r->filler = filler;
+    return r;
+  }
+  AsyncWebServerResponse *beginChunkedResponse(const String &type, AwsResponseFiller filler)
+  {
+    auto *r = new AsyncWebServerResponse();
+    r->contentType = type;
+    r->chunked = true;
+    r->filler = filler;
+    return r;
+  }
+
+  void send(AsyncWebServerResponse *r) { response_.reset(r); }
+  void send(int code, const String &type = String(), const String &content = String())
+  {
+    send(beginResponse(code, type, content));
+  }
+
+  // --- host internals
+  WebRequestMethodComposite method_ = HTTP_GET;
+  String url_;
+  std::vector<AsyncWebParameter> params_;
+  std::vector<AsyncWebHeader> headers_;
+  std::unique_ptr<AsyncWebServerResponse> response_;
+};
+
+typedef std::function<void(AsyncWebServerRequest *request)> ArRequestHandlerFunction;
+
+class AsyncWebServer
+{
+public:
+  explicit AsyncWebServer(uint16_t port) : port_(port) {}
+  ~AsyncWebServer() { end(); }
+
+  void on(const char *uri, WebRequestMethodComposite method, ArRequestHandlerFunction fn)
+  {
+    routes_.push_back({String(uri), method, fn});
+  }
+  void on(const char *uri, ArRequestHandlerFunction fn) { on(uri, HTTP_ANY, fn); }
+  void onNotFound(ArRequestHandlerFunction fn) { notFound_ = fn; }
+
+  // The firmware asks for port 80; the host listens on hostHttpPort instead
+  void begin()
+  {
+    if (running_.exchange(true))
+      return;
+    thread_ = std::thread([this] { run(); });
+  }
+  void end()
+  {
+    if (!running_.exchange(false))
+      return;
+    if (thread_.joinable())
+      thread_.join();
+  }
+
+  // Runs one request through the route table without a socket (benchmarks)
+  void dispatch(AsyncWebServerRequest *req)
+  {
+    for (auto &r : routes_)
+    {
+      if (!(r.method & req->method()))
+        continue;
+      const String &u = req->url();
+      if (u == r.uri || u.startsWith(r.uri + "/"))
+      {
+        r.fn(req);
+        return;
+      }
+    }
+    if (notFound_)
+      notFound_(req);
+    else
+      req->send(404);
+  }
+
+private:
+  struct Route
+  {
+    String uri;
+    WebRequestMethodComposite method;
+    ArRequestHandlerFunction fn;
+  };
+
+  struct Conn
+  {
+    int fd;
+    std::string in;
+    std::string out;
+    std::unique_ptr<AsyncWebServerRequest> req;
+    size_t fillIndex = 0;
+    bool fillDone = false;
+    uint64_t lastFillUs = 0;
+  };
+
+  static std::string urlDecode(const std::string &s)
+  {
+    std::string o;
+    for (size_t i = 0; i < s.size(); i++)
+    {
+      if (s[i] == '+')
+        o += ' ';
+      else if (s[i] == '%' && i + 2 < s.size())
+      {
+        o += (char)strtol(s.substr(i + 1, 2).c_str(), nullptr, 16);
+        i += 2;
+      }
+      else
+        o += s[i];
+    }
+    return o;
+  }
+
+  static void parseParams(const std::string &q, bool post, std::vector<AsyncWebParameter> &out)
+  {
+    size_t pos = 0;
+    while (pos < q.size())
+    {
+      size_t amp = q.find('&', pos);
+      std::string kv = q.substr(pos, amp == std::string::npos ? std::string::npos : amp - pos);
+      size_t eq = kv.find('=');
+      if (!kv.empty())
+        out.emplace_back(String(urlDecode(kv.substr(0, eq))),
+                         String(eq == std::string::npos ? std::string() : urlDecode(kv.substr(eq + 1))), post);
+      if (amp == std::string::npos)
+        break;
+      pos = amp + 1;
+    }
+  }
+
+  static WebRequestMethodComposite parseMethod(const std::string &m)
+  {
+    if (m == "GET")
+      return HTTP_GET;
+    if (m == "POST")
+      return HTTP_POST;
+    if (m == "PUT")
+      return HTTP_PUT;
+    if (m == "DELETE")
+      return HTTP_DELETE;
+    if (m == "PATCH")
+      return HTTP_PATCH;
+    if (m == "HEAD")
+      return HTTP_HEAD;
+    if (m == "OPTIONS")
+      return HTTP_OPTIONS;
+    return 0;
+  }
+
+  static const char *reason(int code)
+  {
+    switch (code)
+    {
+    case 200:
+      return "OK";
+    case 202:
+      return "Accepted";
+    case 304:
+      return "Not Modified";
+    case 400:
+      return "Bad Request";
+    case 403:
+      return "Forbidden";
+    case 404:
+      return "Not Found";
+    case 409:
+      return "Conflict";
+    case 503:
+      return "Service Unavailable";
+    default:
+      return "";
+    }
+  }
+
+  // Returns false when the request is not complete yet
+  bool parseRequest(Conn &c)
+  {
+    size_t end = c.in.find("\r\n\r\n");
+    if (end == std::string::npos)
+      return false;
+    std::unique_ptr<AsyncWebServerRequest> req(new AsyncWebServerRequest());
+    std::istringstream hs(c.in.substr(0, end));
+    std::string line, method, target;
+    std::getline(hs, line);
+    std::istringstream rl(line);
+    rl >> method >> target;
+    req->method_ = parseMethod(method);
+    size_t contentLength = 0;
+    while (std::getline(hs, line))
+    {
+      if (!line.empty() && line.back() == '\r')
+        line.pop_back();
+      size_t colon = line.find(':');
+      if (colon == std::string::npos)
+        continue;
+      std::string v = line.substr(colon + 1);
+      v.erase(0, v.find_first_not_of(' '));
+      req->headers_.emplace_back(String(line.substr(0, colon)), String(v));
+      if (strcasecmp(line.substr(0, colon).c_str(), "Content-Length") == 0)
+        contentLength = strtoul(v.c_str(), nullptr, 10);
+    }
+    if (c.in.size() < end + 4 + contentLength)
+      return false;
+    size_t q = target.find('?');
+    req->url_ = String(urlDecode(target.substr(0, q)));
+    if (q != std::string::npos)
+      parseParams(target.substr(q + 1), false, req->params_);
+    const AsyncWebHeader *ct = req->getHeader("Content-Type");
+    if (contentLength && ct && ct->value().startsWith("application/x-www-form-urlencoded"))
+      parseParams(c.in.substr(end + 4, contentLength), true, req->params_);
+    c.req = std::move(req);
+    return true;
+  }
+
+  void startResponse(Conn &c)
+  {
+    AsyncWebServerResponse *r = c.req->response_.get();
+    if (!r)
+    {
+      c.req->send(500, "text/plain", "no response");
+      r = c.req->response_.get();
+    }
+    std::string h = "HTTP/1.1 " + std::to_string(r->code) + " " + reason(r->code) + "\r\n";
+    for (auto &kv : DefaultHeaders::Instance().headers)
+      h += kv.first.str() + ": " + kv.second.str() + "\r\n";
+    for (auto &kv : r->headers)
+      h += kv.first.str() + ": " + kv.second.str() + "\r\n";
+    if (r->contentType.length())
+      h += "Content-Type: " + r->contentType.str() + "\r\n";
+    if (r->chunked)
+      h += "Transfer-Encoding: chunked\r\n";
+    else
+      h += "Content-Length: " + std::to_string(r->filler ? r->contentLength : r->body.size()) + "\r\n";
+    h += "Connection: close\r\n\r\n";
+    c.out = h;
+    if (!r->filler)
+    {
+      if (c.req->method() != HTTP_HEAD)
+        c.out += r->body;
+      c.fillDone = true;
+    }
+  }
+
+  // Pulls more body out of a callback response; honours RESPONSE_TRY_AGAIN
+  void fill(Conn &c, uint64_t nowUs)
+  {
+    AsyncWebServerResponse *r = c.req->response_.get();
+    if (c.fillDone || !c.out.empty())
+      return;
+    if (c.lastFillUs && nowUs - c.lastFillUs < (uint64_t)hostTcpPollMs.load() * 1000)
+      return;
+    uint8_t buf[1460];
+    size_t n = r->filler(buf, sizeof(buf), c.fillIndex);
+    if (n == RESPONSE_TRY_AGAIN)
+    {
+      c.lastFillUs = nowUs;
+      return;
+    }
+    c.lastFillUs = 0;
+    if (r->chunked)
+    {
+      char len[16];
+      snprintf(len, sizeof(len), "%zx\r\n", n);
+      c.out += len;
+      c.out.append((const char *)buf, n);
+      c.out += "\r\n";
+    }
+    else
+    {
+      c.out.append((const char *)buf, n);
+    }
+    c.fillIndex += n;
+    if (n == 0 || (!r->chunked && c.fillIndex >= r->contentLength))
+      c.fillDone = true;
+  }
+
+  void run()
+  {
+    hostCoreId = 0; // async_tcp task
+    int lfd = socket(AF_INET, SOCK_STREAM, 0);
+    int one = 1;
+    setsockopt(lfd, SOL_SOCKET, SO_REUSEADDR, &one, sizeof(one));
+    sockaddr_in addr{};
+    addr.sin_family = AF_INET;
+    addr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+    addr.sin_port = htons((uint16_t)hostHttpPort.load());
+    if (bind(lfd, (sockaddr *)&addr, sizeof(addr)) != 0 || listen(lfd, 512) != 0)
+    {
+      fprintf(stderr, "[host] cannot listen on port %d\n", hostHttpPort.load());
+      exit(2);
+    }
+    fcntl(lfd, F_SETFL, O_NONBLOCK);
+    (void)port_;
+
+    std::vector<std::unique_ptr<Conn>> conns;
+    std::vector<pollfd> fds;
+    while (running_.load())
+    {
+      fds.clear();
+      fds.push_back({lfd, POLLIN, 0});
+      bool waiting = false;
+      for (auto &c : conns)
+      {
+        short ev = c->req ? (c->out.empty() ? 0 : POLLOUT) : POLLIN;
+        if (c->req && c->out.empty() && !c->fillDone)
+          waiting = true;
+        fds.push_back({c->fd, ev, 0});
+      }
+      poll(fds.data(), fds.size(), waiting ? 5 : 50);
+
+      if (fds[0].revents & POLLIN)
+      {
+        int fd;
+        while ((fd = accept(lfd, nullptr, nullptr)) >= 0)
+        {
+          fcntl(fd, F_SETFL, O_NONBLOCK);
+          setsockopt(fd, IPPROTO_TCP, TCP_NODELAY, &one, sizeof(one));
+          conns.emplace_back(new Conn{fd, {}, {}, {}});
+        }
+      }
+
+      uint64_t nowUs = hostMicros64();
+      for (size_t i = 0; i < conns.size(); i++)
+      {
+        Conn &c = *conns[i];
+        bool close_ = false;
+        if (!c.req)
+        {
+          char buf[4096];
+          ssize_t n = recv(c.fd, buf, sizeof(buf), 0);
+          if (n > 0)
+          {
+            c.in.append(buf, n);
+            if (parseRequest(c))
+            {
+              dispatch(c.req.get());
+              startResponse(c);
+            }
+          }
+          else if (n == 0 || (errno != EAGAIN && errno != EWOULDBLOCK))
+            close_ = true;
+        }
+        if (c.req && !close_)
+        {
+          fill(c, nowUs);
+          while (!c.out.empty())
+          {
+            ssize_t n = ::send(c.fd, c.out.data(), c.out.size(), MSG_NOSIGNAL);
+            if (n > 0)
+              c.out.erase(0, n);
+            else
+            {
+              if (errno != EAGAIN && errno != EWOULDBLOCK)
+                close_ = true;
+              break;
+            }
+            if (c.out.empty())
+              fill(c, nowUs);
+          }
+          if (c.out.empty() && c.fillDone)
+            close_ = true;
+        }
+        if (close_)
+        {
+          close(c.fd);
+          conns.erase(conns.begin() + i);
+          i--;
+        }
+      }
+    }
+    for (auto &c : conns)
+      close(c->fd);
+    close(lfd);
+  }
+
+  uint16_t port_;
+  std::vector<Route> routes_;
+  ArRequestHandlerFunction notFound_;
+  std::atomic<bool> running_{false};
+  std::thread thread_;
+};
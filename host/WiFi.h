@@ -0,0 +1,88 @@
+// Host stand-in for the ESP32 WiFi station API. The access point is simulated:
+// hostWiFiConnectMs is how long association takes (-1 = AP absent).
+#pragma once
+
+#include "Arduino.h"
+
+typedef enum
+{
+  WL_IDLE_STATUS = 0,
+  WL_NO_SSID_AVAIL = 1,
+  WL_CONNECTED = 3,
+  WL_CONNECT_FAILED = 4,
+  WL_CONNECTION_LOST = 5,
+  WL_DISCONNECTED = 6
+} wl_status_t;
+
+typedef enum
+{
+  WIFI_OFF = 0,
+  WIFI_STA = 1
+} wifi_mode_t;
+
+inline std::atomic<long> hostWiFiConnectMs(0);
+
+class IPAddress
+{
+public:
+  IPAddress(uint8_t a = 0, uint8_t b = 0, uint8_t c = 0, uint8_t d = 0) : b_{a, b, c, d} {}
+  String toString() const
+  {
+    char buf[16];
+    snprintf(buf, sizeof(buf), "%u.%u.%u.%u", b_[0], b_[1], b_[2], b_[3]);
+    return String(buf);
+  }
+  operator String() const { return toString(); }
+  uint8_t operator[](int i) const { return b_[i]; }
+
+private:
+  uint8_t b_[4];
+};
+
+class WiFiClass
+{
+public:
+  bool mode(wifi_mode_t) { return true; }
+  wl_status_t begin(const char *ssid, const char *pass, int32_t channel = 0, const uint8_t *bssid = nullptr,
+                    bool connect = true)
+  {
+    (void)ssid;
+    (void)pass;
+    (void)connect;
+    beganMs_ = millis();
+    began_ = true;
+    fastReconnect_ = channel != 0 && bssid != nullptr;
+    return WL_DISCONNECTED;
+  }
+  bool disconnect(bool wifiOff = false)
+  {
+    (void)wifiOff;
+    began_ = false;
+    return true;
+  }
+  bool setAutoReconnect(bool) { return true; }
+  wl_status_t status()
+  {
+    long ms = hostWiFiConnectMs.load();
+    if (!began_ || ms < 0)
+      return WL_DISCONNECTED;
+    // A cached BSSID/channel skips the scan, which is most of the join time
+    unsigned long need = fastReconnect_ ? (unsigned long)ms / 4 : (unsigned long)ms;
+    return millis() - beganMs_ >= need ? WL_CONNECTED : WL_DISCONNECTED;
+  }
+  IPAddress localIP() { return status() == WL_CONNECTED ? IPAddress(127, 0, 0, 1) : IPAddress(); }
+  uint8_t *BSSID()
+  {
+    static uint8_t b[6] = {0x02, 0x00, 0x00, 0x00, 0x00, 0x64};
+    return b;
+  }
+  int32_t channel() { return 6; }
+  int8_t RSSI() { return -55; }
+
+private:
+  bool began_ = false;
+  bool fastReconnect_ = false;
+  unsigned long beganMs_ = 0;
+};
+
+inline WiFiClass WiFi;
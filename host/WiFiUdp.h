@@ -0,0 +1,144 @@
+// Host stand-in for the Arduino-ESP32 WiFiUDP class, the parts used by
+// src/corridor.h (multicast) and src/telemetry.h (unicast). Real UDP sockets
+// on loopback, so several host-built controllers on one machine hear each
+// other: every instance binds the group port with SO_REUSEPORT and joins the
+// group on 127.0.0.1, and multicast loop delivers each datagram to all of
+// them (the sender included, as on the board). hostUdpLossPct drops that
+// share of outgoing datagrams at random.
+#pragma once
+
+#include "WiFi.h"
+
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+#include <random>
+#include <vector>
+
+inline std::atomic<int> hostUdpLossPct(0);
+
+class WiFiUDP
+{
+public:
+  ~WiFiUDP() { stop(); }
+
+  uint8_t beginMulticast(IPAddress group, uint16_t port)
+  {
+    stop();
+    fd_ = socket(AF_INET, SOCK_DGRAM, 0);
+    if (fd_ < 0)
+      return 0;
+    int one = 1;
+    setsockopt(fd_, SOL_SOCKET, SO_REUSEADDR, &one, sizeof(one));
+    setsockopt(fd_, SOL_SOCKET, SO_REUSEPORT, &one, sizeof(one));
+    sockaddr_in addr{};
+    addr.sin_family = AF_INET;
+    addr.sin_port = htons(port);
+    addr.sin_addr.s_addr = htonl(INADDR_ANY);
+    group_.sin_family = AF_INET;
+    group_.sin_port = htons(port);
+    group_.sin_addr.s_addr = htonl(((uint32_t)group[0] << 24) | (group[1] << 16) | (group[2] << 8) | group[3]);
+    ip_mreq mreq{};
+    mreq.imr_multiaddr = group_.sin_addr;
+    mreq.imr_interface.s_addr = htonl(INADDR_LOOPBACK);
+    in_addr ifaddr{};
+    ifaddr.s_addr = htonl(INADDR_LOOPBACK);
+    if (bind(fd_, (sockaddr *)&addr, sizeof(addr)) != 0 ||
+        setsockopt(fd_, IPPROTO_IP, IP_ADD_MEMBERSHIP, &mreq, sizeof(mreq)) != 0 ||
+        setsockopt(fd_, IPPROTO_IP, IP_MULTICAST_IF, &ifaddr, sizeof(ifaddr)) != 0 ||
+        setsockopt(fd_, IPPROTO_IP, IP_MULTICAST_LOOP, &one, sizeof(one)) != 0)
+    {
+      stop();
+      return 0;
+    }
+    return 1;
+  }
+
+  // Unicast socket on port (0: any free port)
+  uint8_t begin(uint16_t port)
+  {
+    stop();
+    fd_ = socket(AF_INET, SOCK_DGRAM, 0);
+    if (fd_ < 0)
+      return 0;
+    sockaddr_in addr{};
+    addr.sin_family = AF_INET;
+    addr.sin_port = htons(port);
+    addr.sin_addr.s_addr = htonl(INADDR_ANY);
+    if (bind(fd_, (sockaddr *)&addr, sizeof(addr)) != 0)
+    {
+      stop();
+      return 0;
+    }
+    return 1;
+  }
+
+  void stop()
+  {
+    if (fd_ >= 0)
+      close(fd_);
+    fd_ = -1;
+  }
+
+  int beginMulticastPacket()
+  {
+    tx_.clear();
+    to_ = group_;
+    return fd_ >= 0;
+  }
+  int beginPacket(IPAddress ip, uint16_t port)
+  {
+    tx_.clear();
+    to_ = {};
+    to_.sin_family = AF_INET;
+    to_.sin_port = htons(port);
+    to_.sin_addr.s_addr = htonl(((uint32_t)ip[0] << 24) | (ip[1] << 16) | (ip[2] << 8) | ip[3]);
+    return fd_ >= 0;
+  }
+  size_t write(const uint8_t *buf, size_t len)
+  {
+    tx_.insert(tx_.end(), buf, buf + len);
+    return len;
+  }
+  size_t write(uint8_t b) { return write(&b, 1); }
+  int endPacket()
+  {
+    if (fd_ < 0)
+      return 0;
+    int loss = hostUdpLossPct.load();
+    if (loss > 0 && (int)(rng_() % 100) < loss)
+      return 1; // lost on the air: the sender cannot tell
+    return sendto(fd_, tx_.data(), tx_.size(), 0, (sockaddr *)&to_, sizeof(to_)) == (ssize_t)tx_.size();
+  }
+
+  // Size of the next datagram, 0 if none; never blocks
+  int parsePacket()
+  {
+    rxLen_ = rxPos_ = 0;
+    if (fd_ < 0)
+      return 0;
+    ssize_t n = recv(fd_, rx_, sizeof(rx_), MSG_DONTWAIT);
+    rxLen_ = n > 0 ? (size_t)n : 0;
+    return (int)rxLen_;
+  }
+  int available() { return (int)(rxLen_ - rxPos_); }
+  int read(uint8_t *buf, size_t len)
+  {
+    size_t n = std::min(len, rxLen_ - rxPos_);
+    memcpy(buf, rx_ + rxPos_, n);
+    rxPos_ += n;
+    return (int)n;
+  }
+  void flush() { rxPos_ = rxLen_; }
+
+private:
+  int fd_ = -1;
+  sockaddr_in group_{};
+  sockaddr_in to_{};
+  std::vector<uint8_t> tx_;
+  uint8_t rx_[1460];
+  size_t rxLen_ = 0, rxPos_ = 0;
+  std::minstd_rand rng_{(unsigned)getpid()};
+};
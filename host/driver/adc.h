@@ -0,0 +1,189 @@
+// Host stand-in for the ESP-IDF 4.4 ADC continuous (DMA) driver, the parts
+// used by src/road_detector.h. Conversions are generated on demand from
+// hostAdcModel at the configured rate, in real or virtual time. Like the
+// DMA ring, the backlog is bounded: if the reader falls behind by more than
+// max_store_buf_size the oldest conversions are lost and the next read
+// returns ESP_ERR_INVALID_STATE.
+#pragma once
+
+#include "../Arduino.h"
+
+typedef int esp_err_t;
+#define ESP_OK 0
+#define ESP_FAIL -1
+#define ESP_ERR_INVALID_ARG 0x102
+#define ESP_ERR_INVALID_STATE 0x103
+#define ESP_ERR_TIMEOUT 0x107
+
+#ifndef BIT
+#define BIT(n) (1UL << (n))
+#endif
+#define ADC_MAX_DELAY UINT32_MAX
+
+typedef enum
+{
+  ADC1_CHANNEL_0 = 0, // GPIO36
+  ADC1_CHANNEL_1,     // GPIO37
+  ADC1_CHANNEL_2,     // GPIO38
+  ADC1_CHANNEL_3,     // GPIO39
+  ADC1_CHANNEL_4,     // GPIO32
+  ADC1_CHANNEL_5,     // GPIO33
+  ADC1_CHANNEL_6,     // GPIO34
+  ADC1_CHANNEL_7,     // GPIO35
+} adc1_channel_t;
+
+typedef enum
+{
+  ADC_ATTEN_DB_0 = 0,
+  ADC_ATTEN_DB_2_5,
+  ADC_ATTEN_DB_6,
+  ADC_ATTEN_DB_11,
+} adc_atten_t;
+
+typedef enum
+{
+  ADC_CONV_SINGLE_UNIT_1 = 1,
+} adc_digi_convert_mode_t;
+
+typedef enum
+{
+  ADC_DIGI_OUTPUT_FORMAT_TYPE1,
+} adc_digi_output_format_t;
+
+typedef struct
+{
+  uint32_t max_store_buf_size;
+  uint32_t conv_num_each_intr;
+  uint32_t adc1_chan_mask;
+  uint32_t adc2_chan_mask;
+} adc_digi_init_config_t;
+
+typedef struct
+{
+  uint8_t atten;
+  uint8_t channel;
+  uint8_t unit;
+  uint8_t bit_width;
+} adc_digi_pattern_config_t;
+
+typedef struct
+{
+  bool conv_limit_en;
+  uint32_t conv_limit_num;
+  uint32_t pattern_num;
+  adc_digi_pattern_config_t *adc_pattern;
+  uint32_t sample_freq_hz;
+  adc_digi_convert_mode_t conv_mode;
+  adc_digi_output_format_t format;
+} adc_digi_configuration_t;
+
+typedef union
+{
+  struct
+  {
+    uint16_t data : 12;
+    uint16_t channel : 4;
+  } type1;
+  uint16_t val;
+} adc_digi_output_data_t;
+
+// Simulated light level: raw 12-bit reading of ADC1 channel at time us.
+// Unset, every channel reads a steady mid-scale level.
+inline uint16_t (*hostAdcModel)(uint8_t channel, uint64_t us) = nullptr;
+
+struct HostAdcDigi
+{
+  adc_digi_init_config_t init{};
+  uint8_t channels[8] = {};
+  uint32_t patternNum = 0;
+  uint32_t freqHz = 0;
+  bool running = false;
+  uint64_t startUs = 0;
+  uint64_t next = 0; // index of the next conversion since start
+  bool overflowed = false;
+};
+inline HostAdcDigi hostAdc;
+
+inline esp_err_t adc_digi_initialize(const adc_digi_init_config_t *init_config)
+{
+  if (!init_config || init_config->max_store_buf_size < init_config->conv_num_each_intr)
+    return ESP_ERR_INVALID_ARG;
+  hostAdc.init = *init_config;
+  return ESP_OK;
+}
+
+inline esp_err_t adc_digi_controller_configure(const adc_digi_configuration_t *config)
+{
+  if (!config || config->pattern_num == 0 || config->pattern_num > 8 || config->sample_freq_hz < 20000)
+    return ESP_ERR_INVALID_ARG;
+  for (uint32_t i = 0; i < config->pattern_num; i++)
+    hostAdc.channels[i] = config->adc_pattern[i].channel;
+  hostAdc.patternNum = config->pattern_num;
+  hostAdc.freqHz = config->sample_freq_hz;
+  return ESP_OK;
+}
+
+inline esp_err_t adc_digi_start()
+{
+  if (hostAdc.freqHz == 0)
+    return ESP_ERR_INVALID_STATE;
+  hostAdc.startUs = hostMicros64();
+  hostAdc.next = 0;
+  hostAdc.running = true;
+  return ESP_OK;
+}
+
+inline esp_err_t adc_digi_stop()
+{
+  hostAdc.running = false;
+  return ESP_OK;
+}
+
+inline esp_err_t adc_digi_deinitialize()
+{
+  hostAdc = HostAdcDigi();
+  return ESP_OK;
+}
+
+// Waits for a full DMA block (conv_num_each_intr bytes), as the driver does
+inline esp_err_t adc_digi_read_bytes(uint8_t *buf, uint32_t length_max, uint32_t *out_length, uint32_t timeout_ms)
+{
+  *out_length = 0;
+  if (!hostAdc.running)
+    return ESP_ERR_INVALID_STATE;
+  const uint32_t sampleBytes = sizeof(adc_digi_output_data_t);
+  uint64_t waitedUs = 0;
+  for (;;)
+  {
+    uint64_t due = (hostMicros64() - hostAdc.startUs) * hostAdc.freqHz / 1000000;
+    uint64_t backlog = due - hostAdc.next;
+    if (backlog * sampleBytes > hostAdc.init.max_store_buf_size)
+    {
+      hostAdc.next = due - hostAdc.init.max_store_buf_size / sampleBytes;
+      hostAdc.overflowed = true;
+      backlog = due - hostAdc.next;
+    }
+    if (backlog * sampleBytes >= hostAdc.init.conv_num_each_intr)
+      break;
+    if (timeout_ms != ADC_MAX_DELAY && waitedUs >= (uint64_t)timeout_ms * 1000)
+      return ESP_ERR_TIMEOUT;
+    std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    waitedUs += 1000;
+  }
+
+  uint32_t n = std::min<uint32_t>(hostAdc.init.conv_num_each_intr, length_max) / sampleBytes;
+  for (uint32_t i = 0; i < n; i++, hostAdc.next++)
+  {
+    uint8_t ch = hostAdc.channels[hostAdc.next % hostAdc.patternNum];
+    uint64_t us = hostAdc.startUs + hostAdc.next * 1000000 / hostAdc.freqHz;
+    adc_digi_output_data_t d;
+    d.val = 0;
+    d.type1.channel = ch;
+    d.type1.data = (hostAdcModel ? hostAdcModel(ch, us) : 2048) & 0xfff;
+    memcpy(buf + i * sampleBytes, &d, sampleBytes);
+  }
+  *out_length = n * sampleBytes;
+  bool lost = hostAdc.overflowed;
+  hostAdc.overflowed = false;
+  return lost ? ESP_ERR_INVALID_STATE : ESP_OK;
+}
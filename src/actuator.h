@@ -0,0 +1,257 @@
+// Bridge deck actuator
+// DeckActuator<Drive> estimates the deck position from elapsed drive time and
+// stops the drive when the target is reached. moveTo()/stop()/update() never
+// block. The drive hardware is a template parameter, so swapping the DC motor
+// for the continuous servo is a compile-time choice with no virtual calls.
+#pragma once
+
+#include <Arduino.h>
+#ifndef BRIDGE_HOST
+#include <soc/gpio_sig_map.h>
+#include <soc/gpio_struct.h>
+#endif
+
+// Pin low straight through the GPIO registers, taking it away from any
+// peripheral (LEDC) routed to it. A few bus writes and no driver calls, so
+// it is safe in an ISR. The pin stays a plain GPIO until begin() re-arms it.
+inline void IRAM_ATTR gpioForceLow(uint8_t pin)
+{
+#ifdef BRIDGE_HOST
+  hostGpioForceLow(pin);
+#else
+  GPIO.func_out_sel_cfg[pin].func_sel = SIG_GPIO_OUT_IDX;
+  if (pin < 32)
+    GPIO.out_w1tc = 1UL << pin;
+  else
+    GPIO.out1_w1tc.val = 1UL << (pin - 32);
+#endif
+}
+
+// Deck positions, per-mille of full travel
+const uint16_t DECK_CLOSED = 0;
+const uint16_t DECK_OPEN = 1000;
+
+// H-bridge DC motor: IN1/IN2 pick the direction, EN carries LEDC PWM
+const uint32_t DC_PWM_FREQ = 30000;
+const uint8_t DC_PWM_BITS = 8;
+
+struct DcMotorDrive
+{
+  uint8_t in1;
+  uint8_t in2;
+  uint8_t en;
+  uint8_t channel;
+  uint8_t duty; // 0..255 while moving
+
+  void begin()
+  {
+    pinMode(in1, OUTPUT);
+    pinMode(in2, OUTPUT);
+    ledcSetup(channel, DC_PWM_FREQ, DC_PWM_BITS);
+    ledcAttachPin(en, channel);
+    drive(0);
+  }
+
+  // +1 = up (open), -1 = down (close), 0 = stop
+  void drive(int dir)
+  {
+    digitalWrite(in1, dir < 0 ? HIGH : LOW);
+    digitalWrite(in2, dir > 0 ? HIGH : LOW);
+    ledcWrite(channel, dir ? duty : 0);
+  }
+
+  // E-stop: both bridge inputs and the enable low, from any context
+  void IRAM_ATTR emergencyOff()
+  {
+    gpioForceLow(en);
+    gpioForceLow(in1);
+    gpioForceLow(in2);
+  }
+};
+
+// Continuous-rotation servo on a 50 Hz LEDC channel. Speed and direction come
+// from the pulse width, using the write(angle) scale of ESP32Servo.
+const uint32_t SERVO_PERIOD_US = 20000;
+const uint32_t SERVO_MIN_US = 544;
+const uint32_t SERVO_MAX_US = 2400;
+
+struct ServoDrive
+{
+  uint8_t pin;
+  uint8_t channel;
+  uint8_t stopAngle;    // our servo stops at 94
+  uint8_t forwardAngle; // 180 = full speed CW
+  uint8_t reverseAngle; // 0 = full speed CCW
+
+  void begin()
+  {
+    ledcSetup(channel, 1000000 / SERVO_PERIOD_US, 16);
+    ledcAttachPin(pin, channel);
+    drive(0);
+  }
+
+  void drive(int dir)
+  {
+    uint32_t angle = dir > 0 ? forwardAngle : (dir < 0 ? reverseAngle : stopAngle);
+    uint32_t pulseUs = SERVO_MIN_US + angle * (SERVO_MAX_US - SERVO_MIN_US) / 180;
+    ledcWrite(channel, pulseUs * 65535UL / SERVO_PERIOD_US);
+  }
+
+  // E-stop: no more pulses; a continuous servo without a signal stops
+  void IRAM_ATTR emergencyOff() { gpioForceLow(pin); }
+};
+
+template <typename Drive>
+class DeckActuator
+{
+public:
+  DeckActuator(const Drive &drive, unsigned long travelMs) : drive_(drive), travelMs_(travelMs) {}
+
+  void begin() { drive_.begin(); }
+
+  // Head for target. Re-issuing the current target changes nothing, so
+  // repeated commands don't restart the move.
+  void moveTo(uint16_t target, unsigned long now)
+  {
+    update(now);
+    unsigned long targetMs = toMs(target);
+    if (target == target_ && (dir_ != 0 || (posMs_ == targetMs && !seats())))
+      return;
+    target_ = target;
+    targetMs_ = targetMs;
+    fromMs_ = posMs_;
+    int dir = targetMs_ > posMs_ ? 1 : (targetMs_ < posMs_ ? -1 : 0);
+    if (dir == 0 && seats())
+      dir = target_ == DECK_OPEN ? 1 : -1; // there already, on paper
+    if (dir != dir_)
+    {
+      dir_ = dir;
+      drive_.drive(dir);
+    }
+  }
+
+  // After a reset: the deck stopped near position when the drive lost
+  // power, up to slackMs of drive time either way. Stopped there, with that
+  // as the target.
+  void restore(uint16_t position, unsigned long slackMs, unsigned long now)
+  {
+    halt();
+    posMs_ = fromMs_ = targetMs_ = toMs(position);
+    target_ = position;
+    slackMs_ = slackMs < travelMs_ ? slackMs : travelMs_;
+    lastMs_ = now;
+  }
+
+  // Halt where we are; the position estimate stays valid
+  void stop(unsigned long now)
+  {
+    update(now);
+    halt();
+    targetMs_ = posMs_;
+    target_ = fromMs(posMs_);
+  }
+
+  // Advance the position estimate. Returns true on the call that reaches the
+  // target (the drive is stopped then). With slack, a move to either end
+  // drives on against the end stop for the slack, so the deck really is
+  // there; that takes the slack out.
+  bool update(unsigned long now)
+  {
+    if ((long)(now - lastMs_) < 0)
+      return false; // stamp from before the last update (e-stop time)
+    unsigned long dt = now - lastMs_;
+    lastMs_ = now;
+    if (dir_ == 0)
+      return false;
+    unsigned long was = posMs_;
+    posMs_ = advance(posMs_, dt);
+    if (posMs_ != targetMs_)
+      return false;
+    if (seats())
+    {
+      unsigned long over = dt - dist(was, posMs_);
+      if (over < slackMs_)
+      {
+        slackMs_ -= over;
+        return false;
+      }
+      slackMs_ = 0;
+    }
+    halt();
+    return true;
+  }
+
+  bool moving() const { return dir_ != 0; }
+  int direction() const { return dir_; }
+  uint16_t target() const { return target_; }
+  uint16_t position() const { return fromMs(posMs_); }
+  // Drive time the estimate may be out by, since the last reset
+  unsigned long slackMs() const { return slackMs_; }
+
+  // Percent of the current move done (100 when not moving)
+  uint8_t progress(unsigned long now) const
+  {
+    unsigned long span = dist(fromMs_, targetMs_);
+    if (dir_ == 0 || span == 0)
+      return 100;
+    return (uint8_t)(100 * dist(fromMs_, advance(posMs_, now - lastMs_)) / span);
+  }
+
+  // Time left until the target is reached at the current speed
+  unsigned long remainingMs(unsigned long now) const
+  {
+    return dir_ == 0 ? 0 : dist(advance(posMs_, now - lastMs_), targetMs_);
+  }
+
+  // Drive off right now (no position update)
+  void cut()
+  {
+    dir_ = 0;
+    drive_.drive(0);
+  }
+
+  // E-stop from an ISR or another task: hardware off, nothing else touched.
+  // The owner then calls stop() to settle the estimate and rearm() to drive
+  // again.
+  void IRAM_ATTR emergencyOff() { drive_.emergencyOff(); }
+
+  void rearm()
+  {
+    dir_ = 0;
+    drive_.begin();
+  }
+
+  Drive &drive() { return drive_; }
+
+private:
+  void halt()
+  {
+    if (dir_ != 0)
+      cut();
+  }
+
+  bool seats() const { return slackMs_ != 0 && (target_ == DECK_CLOSED || target_ == DECK_OPEN); }
+
+  unsigned long advance(unsigned long pos, unsigned long dt) const
+  {
+    if (dir_ > 0)
+      return targetMs_ - pos <= dt ? targetMs_ : pos + dt;
+    if (dir_ < 0)
+      return pos - targetMs_ <= dt ? targetMs_ : pos - dt;
+    return pos;
+  }
+
+  static unsigned long dist(unsigned long a, unsigned long b) { return a > b ? a - b : b - a; }
+  unsigned long toMs(uint16_t p) const { return (unsigned long)p * travelMs_ / DECK_OPEN; }
+  uint16_t fromMs(unsigned long ms) const { return (uint16_t)(ms * DECK_OPEN / travelMs_); }
+
+  Drive drive_;
+  unsigned long travelMs_;
+  unsigned long posMs_ = 0; // deck starts closed
+  unsigned long fromMs_ = 0;
+  unsigned long targetMs_ = 0;
+  uint16_t target_ = DECK_CLOSED;
+  int dir_ = 0;
+  unsigned long slackMs_ = 0;
+  unsigned long lastMs_ = 0;
+};
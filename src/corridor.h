@@ -0,0 +1,361 @@
+// Bridge-to-bridge coordination
+// Bridges along one channel share what their sensors see over UDP multicast,
+// so a bridge can open for a boat before the boat reaches its own sensors.
+// A track is one boat: where and when a bridge last saw it, its direction
+// and speed. Every bridge works out its own ETA from that, so the bridges
+// need no common clock: messages carry the age of a sighting, not a time.
+//
+// Datagrams, little endian:
+//   header  u8 'B', u8 'C', u8 version, u8 type, u8 sender id, u8 boot,
+//           u16 seq
+//   HELLO   u8 state, u8 0, u16 deck position, i32 position cm
+//   TRACK   u16 track id, u8 rev, i8 dir, u8 seen by, u8 0, u16 speed cm/s,
+//           i32 seen at cm, u32 age ms
+// Seq numbers are per sender and start over at every boot; boot is a random
+// nonzero byte drawn at each boot. A receiver counts gaps as losses and drops
+// copies older than the last it took. When boot changes, or the sender
+// comes back from silence at a seq near 1 (the one time in 255 boot repeats
+// itself), the sender restarted and its seqs are taken afresh. Nothing is acknowledged: the bridge
+// that last saw a boat repeats the track for a while, and each copy carries
+// all of it, so any one getting through is enough.
+#pragma once
+
+#include <Arduino.h>
+#include <WiFiUdp.h>
+
+const uint16_t CORR_PORT = 6464;
+const uint8_t CORR_VERSION = 1;
+const int CORR_PEERS = 8;
+const int CORR_TRACKS = 4;
+const int CORR_RX_PER_TICK = 8;                   // datagrams read per call to poll()
+const unsigned long CORR_HELLO_MS = 1000;
+const unsigned long CORR_RESEND_MS = 500;         // repeat a fresh sighting this often ...
+const unsigned long CORR_RESEND_FOR_MS = 30000;   // ... for this long after it
+const unsigned long CORR_TRACK_TTL_MS = 300000;   // then forget it after this long
+const unsigned long CORR_PEER_TTL_MS = 30000;     // a bridge not heard for this long is gone
+const unsigned long CORR_RESTART_QUIET_MS = 2000; // silence before a low seq ...
+const uint16_t CORR_RESTART_SEQ = 4;              // ... up to this one means a restart
+const uint16_t CORR_SPEED_MIN_CMS = 2;
+const uint16_t CORR_SPEED_MAX_CMS = 1000;
+const size_t CORR_HEADER_BYTES = 8;
+const size_t CORR_HELLO_BYTES = CORR_HEADER_BYTES + 8;
+const size_t CORR_TRACK_BYTES = CORR_HEADER_BYTES + 16;
+
+enum CorridorMsg : uint8_t
+{
+  CORR_HELLO = 1,
+  CORR_TRACK = 2
+};
+
+struct CorridorPeer
+{
+  uint8_t id;
+  uint8_t boot;
+  uint8_t state;
+  uint16_t deck;
+  int32_t posCm;
+  uint16_t lastSeq;
+  unsigned long heardMs;
+  uint32_t received;
+  uint32_t lost;
+};
+
+struct CorridorTrack
+{
+  uint16_t id;          // sighting bridge id << 8 | its counter (seeded per boot)
+  uint8_t rev;          // bumped at every new sighting
+  int8_t dir;           // +1: towards higher positions
+  uint8_t seenBy;
+  uint16_t speedCms;
+  int32_t seenAtCm;
+  unsigned long seenMs; // local clock
+  unsigned long sentMs; // last copy sent (tracks this bridge saw last)
+  bool passed;          // has passed this bridge
+
+  // Distance still to go to posCm; negative once past it
+  int32_t toGoCm(int32_t posCm) const { return (posCm - seenAtCm) * dir; }
+  long travelMs(int32_t posCm) const { return (long)toGoCm(posCm) * 1000 / speedCms; }
+  long etaMs(int32_t posCm, unsigned long now) const { return travelMs(posCm) - (long)(now - seenMs); }
+};
+
+class Corridor
+{
+public:
+  // Joins the group; false if the socket could not be opened
+  bool begin(uint8_t id, int32_t posCm, uint16_t speedCms)
+  {
+    id_ = id;
+    posCm_ = posCm;
+    speedCms_ = speedCms;
+    // Neighbours keep tracks for CORR_TRACK_TTL_MS and refuse older revs of
+    // one they hold, so a restarted bridge must not start over at the ids
+    // it used before
+    nextTrack_ = (uint8_t)esp_random();
+    boot_ = (uint8_t)(esp_random() % 255 + 1);
+    started_ = udp_.beginMulticast(IPAddress(239, 64, 0, 1), CORR_PORT) != 0;
+    return started_;
+  }
+
+  // Reads what has arrived, a bounded number of datagrams per call
+  void poll(unsigned long now)
+  {
+    if (!started_)
+      return;
+    uint8_t buf[64];
+    for (int i = 0; i < CORR_RX_PER_TICK; i++)
+    {
+      int len = udp_.parsePacket();
+      if (len <= 0)
+        break;
+      int n = udp_.read(buf, sizeof(buf));
+      udp_.flush();
+      receive(buf, len > n ? 0 : n, now);
+    }
+  }
+
+  // This bridge's sensors picked up a boat heading dir. Continues the track
+  // of a boat that was expected here, timing it since its last sighting,
+  // or starts a new one; either way the track goes out straight away.
+  // Nothing to share before begin().
+  const CorridorTrack *sighted(int8_t dir, unsigned long now)
+  {
+    if (!started_)
+      return nullptr;
+    CorridorTrack *t = nullptr;
+    long best = 0;
+    for (int i = 0; i < trackCount_; i++)
+    {
+      CorridorTrack &c = tracks_[i];
+      if (c.passed || c.dir != dir || c.toGoCm(posCm_) <= 0)
+        continue;
+      long off = abs(c.etaMs(posCm_, now));
+      if (off <= c.travelMs(posCm_) && (!t || off < best))
+      {
+        t = &c;
+        best = off;
+      }
+    }
+    if (t)
+    {
+      long took = (long)(now - t->seenMs);
+      long speed = took > 0 ? (long)t->toGoCm(posCm_) * 1000 / took : t->speedCms;
+      t->speedCms = (uint16_t)constrain(speed, (long)CORR_SPEED_MIN_CMS, (long)CORR_SPEED_MAX_CMS);
+      t->rev++;
+    }
+    else
+    {
+      t = slot();
+      *t = {};
+      t->id = (uint16_t)(id_ << 8 | nextTrack_++);
+      t->dir = dir;
+      t->speedCms = speedCms_;
+    }
+    t->seenBy = id_;
+    t->seenAtCm = posCm_;
+    t->seenMs = now;
+    t->passed = true;
+    sendTrack(*t, now);
+    return t;
+  }
+
+  // Heartbeat, repeats of fresh sightings, and expiry; call every tick
+  void service(unsigned long now, uint8_t state, uint16_t deck)
+  {
+    for (int i = 0; i < trackCount_;)
+      if (now - tracks_[i].seenMs >= CORR_TRACK_TTL_MS)
+        tracks_[i] = tracks_[--trackCount_];
+      else
+        i++;
+    for (int i = 0; i < peerCount_;)
+      if (now - peers_[i].heardMs >= CORR_PEER_TTL_MS)
+        peers_[i] = peers_[--peerCount_];
+      else
+        i++;
+    if (!started_)
+      return;
+    if (now - helloMs_ >= CORR_HELLO_MS || helloMs_ == 0)
+    {
+      helloMs_ = now ? now : 1;
+      uint8_t buf[CORR_HELLO_BYTES] = {};
+      header(buf, CORR_HELLO);
+      buf[8] = state;
+      put16(buf + 10, deck);
+      put32(buf + 12, (uint32_t)posCm_);
+      send(buf, sizeof(buf));
+    }
+    for (int i = 0; i < trackCount_; i++)
+    {
+      CorridorTrack &t = tracks_[i];
+      if (t.seenBy == id_ && now - t.seenMs < CORR_RESEND_FOR_MS && now - t.sentMs >= CORR_RESEND_MS)
+        sendTrack(t, now);
+    }
+  }
+
+  int trackCount() const { return trackCount_; }
+  const CorridorTrack &track(int i) const { return tracks_[i]; }
+  int peerCount() const { return peerCount_; }
+  const CorridorPeer &peer(int i) const { return peers_[i]; }
+  uint32_t sent() const { return sent_; }
+  uint32_t received() const { return received_; }
+  uint32_t lost() const { return lost_; }
+  uint32_t stale() const { return stale_; }
+  uint32_t bad() const { return bad_; }
+
+private:
+  static void put16(uint8_t *p, uint16_t v)
+  {
+    p[0] = (uint8_t)v;
+    p[1] = (uint8_t)(v >> 8);
+  }
+  static void put32(uint8_t *p, uint32_t v)
+  {
+    put16(p, (uint16_t)v);
+    put16(p + 2, (uint16_t)(v >> 16));
+  }
+  static uint16_t get16(const uint8_t *p) { return (uint16_t)(p[0] | p[1] << 8); }
+  static uint32_t get32(const uint8_t *p) { return get16(p) | (uint32_t)get16(p + 2) << 16; }
+
+  void header(uint8_t *p, CorridorMsg type)
+  {
+    p[0] = 'B';
+    p[1] = 'C';
+    p[2] = CORR_VERSION;
+    p[3] = type;
+    p[4] = id_;
+    p[5] = boot_;
+    put16(p + 6, ++seq_);
+  }
+
+  void send(const uint8_t *buf, size_t len)
+  {
+    udp_.beginMulticastPacket();
+    udp_.write(buf, len);
+    if (udp_.endPacket())
+      sent_++;
+  }
+
+  void sendTrack(CorridorTrack &t, unsigned long now)
+  {
+    t.sentMs = now;
+    uint8_t buf[CORR_TRACK_BYTES] = {};
+    header(buf, CORR_TRACK);
+    put16(buf + 8, t.id);
+    buf[10] = t.rev;
+    buf[11] = (uint8_t)t.dir;
+    buf[12] = t.seenBy;
+    put16(buf + 14, t.speedCms);
+    put32(buf + 16, (uint32_t)t.seenAtCm);
+    put32(buf + 20, (uint32_t)(now - t.seenMs));
+    send(buf, sizeof(buf));
+  }
+
+  // Free track slot, or the one seen longest ago
+  CorridorTrack *slot()
+  {
+    if (trackCount_ < CORR_TRACKS)
+      return &tracks_[trackCount_++];
+    CorridorTrack *oldest = &tracks_[0];
+    for (int i = 1; i < CORR_TRACKS; i++)
+      if ((long)(tracks_[i].seenMs - oldest->seenMs) < 0)
+        oldest = &tracks_[i];
+    return oldest;
+  }
+
+  CorridorPeer *peerFor(uint8_t id)
+  {
+    for (int i = 0; i < peerCount_; i++)
+      if (peers_[i].id == id)
+        return &peers_[i];
+    if (peerCount_ == CORR_PEERS)
+      return nullptr;
+    CorridorPeer *p = &peers_[peerCount_++];
+    *p = {};
+    p->id = id;
+    return p;
+  }
+
+  void receive(const uint8_t *p, int len, unsigned long now)
+  {
+    if (len < (int)CORR_HEADER_BYTES || p[0] != 'B' || p[1] != 'C' || p[2] != CORR_VERSION)
+    {
+      bad_++;
+      return;
+    }
+    uint8_t from = p[4];
+    if (from == id_)
+      return; // our own, looped back
+    CorridorPeer *peer = peerFor(from);
+    if (!peer)
+    {
+      bad_++;
+      return;
+    }
+    uint16_t seq = get16(p + 6);
+    int16_t gap = (int16_t)(seq - peer->lastSeq);
+    bool restarted = p[5] != peer->boot ||
+                     (seq <= CORR_RESTART_SEQ && now - peer->heardMs >= CORR_RESTART_QUIET_MS);
+    bool known = peer->received && !restarted;
+    if (known && gap <= 0 && gap > -64)
+    {
+      stale_++; // duplicate or overtaken; a bigger jump back is a restart
+      return;
+    }
+    if (known && gap > 1)
+    {
+      peer->lost += gap - 1;
+      lost_ += gap - 1;
+    }
+    peer->boot = p[5];
+    peer->lastSeq = seq;
+    peer->heardMs = now;
+    peer->received++;
+    received_++;
+
+    if (p[3] == CORR_HELLO && len >= (int)CORR_HELLO_BYTES)
+    {
+      peer->state = p[8];
+      peer->deck = get16(p + 10);
+      peer->posCm = (int32_t)get32(p + 12);
+    }
+    else if (p[3] == CORR_TRACK && len >= (int)CORR_TRACK_BYTES)
+    {
+      uint16_t id = get16(p + 8);
+      uint8_t rev = p[10];
+      CorridorTrack *t = nullptr;
+      for (int i = 0; i < trackCount_ && !t; i++)
+        if (tracks_[i].id == id)
+          t = &tracks_[i];
+      if (t && (int8_t)(rev - t->rev) < 0)
+        return; // we already have a later sighting
+      if (!t)
+      {
+        t = slot();
+        *t = {};
+        t->id = id;
+      }
+      t->rev = rev;
+      t->dir = (int8_t)p[11] < 0 ? -1 : 1;
+      t->seenBy = p[12];
+      t->speedCms = (uint16_t)constrain((long)get16(p + 14), (long)CORR_SPEED_MIN_CMS, (long)CORR_SPEED_MAX_CMS);
+      t->seenAtCm = (int32_t)get32(p + 16);
+      t->seenMs = now - get32(p + 20);
+    }
+    else
+      bad_++;
+  }
+
+  WiFiUDP udp_;
+  bool started_ = false;
+  uint8_t id_ = 0;
+  int32_t posCm_ = 0;
+  uint16_t speedCms_ = 0;
+  uint16_t seq_ = 0;
+  uint8_t boot_ = 0;
+  uint8_t nextTrack_ = 0;
+  unsigned long helloMs_ = 0;
+  CorridorPeer peers_[CORR_PEERS];
+  int peerCount_ = 0;
+  CorridorTrack tracks_[CORR_TRACKS];
+  int trackCount_ = 0;
+  uint32_t sent_ = 0, received_ = 0, lost_ = 0, stale_ = 0, bad_ = 0;
+};
@@ -0,0 +1,73 @@
+// Traffic lamps
+// Every lamp is a LEDC channel, and a flashing lamp is just a very slow PWM
+// wave, so the peripheral keeps the flash timing whatever the control loop is
+// doing. Callers declare a LampPattern; set() is idempotent and only touches
+// the hardware when the pattern changes. The UI mirror is the pattern itself.
+#pragma once
+
+#include <Arduino.h>
+
+const uint8_t LAMP_PWM_BITS = 10;
+
+struct LampPattern
+{
+  uint16_t periodMs; // 0 = steady
+  uint16_t onMs;     // steady: lit if non-zero; flashing: lit part of each period
+
+  bool flashing() const { return periodMs != 0; }
+  bool lit() const { return onMs != 0; }
+  bool operator==(const LampPattern &o) const { return periodMs == o.periodMs && onMs == o.onMs; }
+  bool operator!=(const LampPattern &o) const { return !(*this == o); }
+};
+
+const LampPattern LAMP_OFF = {0, 0};
+const LampPattern LAMP_ON = {0, 1};
+
+// LEDC timers run at whole hertz, so the period must divide one second
+constexpr LampPattern lampFlash(uint16_t periodMs, uint8_t dutyPct = 50)
+{
+  return {periodMs, (uint16_t)((uint32_t)periodMs * dutyPct / 100)};
+}
+
+// Each lamp needs a LEDC timer of its own to flash at its own rate. The
+// Arduino core maps channel c to timer (c / 2) % 4 of group c / 8, so lamps
+// take even channels from 2 up; channel 0 (timer 0) belongs to the deck.
+class Lamp
+{
+public:
+  Lamp(uint8_t pin, uint8_t channel) : pin_(pin), channel_(channel) {}
+
+  void begin()
+  {
+    ledcSetup(channel_, 1000, LAMP_PWM_BITS);
+    ledcAttachPin(pin_, channel_);
+    ledcWrite(channel_, 0);
+    pattern_ = LAMP_OFF;
+  }
+
+  // True if the pattern changed
+  bool set(const LampPattern &p)
+  {
+    if (p == pattern_)
+      return false;
+    const uint32_t full = 1u << LAMP_PWM_BITS; // LEDC reads this as always high
+    pattern_ = p;
+    if (p.flashing() && ledcSetup(channel_, 1000.0 / p.periodMs, LAMP_PWM_BITS) != 0)
+      ledcWrite(channel_, (uint32_t)((uint64_t)full * p.onMs / p.periodMs));
+    else
+    {
+      // A flash the timer cannot make shows steady, and says so
+      if (p.flashing())
+        pattern_ = LAMP_ON;
+      ledcWrite(channel_, pattern_.lit() ? full : 0);
+    }
+    return true;
+  }
+
+  const LampPattern &pattern() const { return pattern_; }
+
+private:
+  uint8_t pin_;
+  uint8_t channel_;
+  LampPattern pattern_ = LAMP_OFF;
+};
@@ -2,49 +2,85 @@
 #include <WiFi.h>
 #include <AsyncTCP.h>
 #include <ESPAsyncWebServer.h>
-#include <SPIFFS.h>
+#include <atomic>
+#include <memory>
+#include <vector>
+#ifndef BRIDGE_HOST
+#include <esp_timer.h>
+#include <hal/cpu_hal.h>
+#endif
+
+#include "actuator.h"
+#include "corridor.h"
+#include "lamps.h"
+#include "road_detector.h"
+#include "telemetry.h"
+#include "web_assets.h"
 
 // Wifi credentials
 static const char *WIFI_SSID = "Group64";
 static const char *WIFI_PASS = "64GroupProject";
 
 // Motor pins
-int motor1Pin1 = 27;
-int motor1Pin2 = 26;
-int enable1Pin = 25; // PWM (LEDC) pin
+const int motor1Pin1 = 27;
+const int motor1Pin2 = 26;
+const int enable1Pin = 25; // PWM (LEDC) pin, servo signal on the servo rig
 
 // Road Traffic Lights Pins
-int redLEDPin_R = 32;
-int yellowLEDPin_R = 35;
-int greenLEDPin_R = 34;
+const int redLEDPin_R = 32;
+const int yellowLEDPin_R = 35;
+const int greenLEDPin_R = 34;
 
 // Boat Traffic Lights Pins
-int redLEDPin_B = 16;
-int yellowLEDPin_B = 17;
-int greenLEDPin_B = 18;
+const int redLEDPin_B = 16;
+const int yellowLEDPin_B = 17;
+const int greenLEDPin_B = 18;
 
 // Light Sensor LED
 int whiteLEDPin = 19;
 
+// Light sensors under the LED, one per road lane (ADC1, read by DMA):
+// GPIO36 = ADC1_CH0, GPIO39 = ADC1_CH3
+RoadDetector roadSensor(ADC1_CHANNEL_0, ADC1_CHANNEL_3);
+
+// Emergency stop button (normally open, to GND)
+const int estopPin = 23;
+
 // Ultrasonic Sensor Pins
 const int trigPin_A = 2;
 const int echoPin_A = 15;
 const int trigPin_B = 4;
 const int echoPin_B = 5;
 
-// Distance Variables
-float distanceA = 0;
-float distanceB = 0;
+// Distance Variables (latest sample from loop(), read by /distance).
+// Start at the "no echo" reading so nothing is detected before the first ping.
+std::atomic<float> distanceA(400);
+std::atomic<float> distanceB(400);
 bool boatDetected = false;
 
+// Policy knobs are constants on the board; host tools (tools/policy_sweep.cpp)
+// set them before setup()
+#ifdef BRIDGE_HOST
+#define BRIDGE_TUNABLE
+#else
+#define BRIDGE_TUNABLE const
+#endif
+
 // timings variables (ms)
+#ifdef BRIDGE_DRIVE_SERVO
+const unsigned long ROTATION_DURATION = 1000; // 1s servo turn (open/close)
+#else
 const unsigned long ROTATION_DURATION = 4000; // 4s motor move (open/close)
-const unsigned long ROAD_WARNING_MS = 3000;   // 3s road yellow
-const unsigned long BOAT_WARNING_MS = 3000;   // 3s boat yellow flashing
-const unsigned long CLEAR_WINDOW_MS = 6000;   // 6s "no boat" before closing
-const unsigned long STOP_DURATION = 2000;     // (not used in this flow)
+#endif
+BRIDGE_TUNABLE unsigned long ROAD_WARNING_MS = 3000; // 3s road yellow
+BRIDGE_TUNABLE unsigned long BOAT_WARNING_MS = 3000; // 3s boat yellow flashing
+BRIDGE_TUNABLE unsigned long CLEAR_WINDOW_MS = 6000; // 6s "no boat" before closing
+const unsigned long STOP_DURATION = 2000;            // (not used in this flow)
+
+// Detection thresholds (cm)
+BRIDGE_TUNABLE float DETECT_CM = 50; // a boat this close starts the cycle
+BRIDGE_TUNABLE float CLEAR_CM = 70;  // both sensors beyond this count as clear
 
-unsigned long rotationStartTime = 0;
 unsigned long yellowStartTime = 0;
 unsigned long boatClearTime = 0;
 
@@ -55,90 +91,286 @@ enum MotorState
   BOAT_WARNING,   // 3s boat yellow flashing (with boat red)
   BRIDGE_OPENING, // motor up
   BRIDGE_OPEN,    // boat green
-  BRIDGE_CLOSING  // 3s boat yellow flashing + motor down
+  BRIDGE_CLOSING, // 3s boat yellow flashing + motor down
+  FAULT           // e-stop tripped: drive cut, all red until reset
 };
 MotorState currentState = IDLE;
 
-// Manual override (UI)
-bool manualMode = false; // Auto by default
+// Manual override (UI); written only by the control loop, read by handlers
+std::atomic<bool> manualMode(false); // Auto by default
 
-// PWM (LEDC) Variables 
+// PWM (LEDC) Variables
 const int pwmChannel = 0;
-const int pwmFreq = 30000;
-const int pwmResBits = 8;
-int dutyCycle = 200; // 0..255
+const int dutyCycle = 200; // 0..255
+
+// Deck drive, picked at compile time. Default is the H-bridge DC motor;
+// -DBRIDGE_DRIVE_SERVO selects the continuous servo rig
+// (prototypes/prototype_servo.cpp) with its signal on enable1Pin.
+#ifdef BRIDGE_DRIVE_SERVO
+typedef ServoDrive DeckDrive;
+DeckActuator<DeckDrive> deck(DeckDrive{enable1Pin, pwmChannel, 94, 180, 0}, ROTATION_DURATION);
+#else
+typedef DcMotorDrive DeckDrive;
+DeckActuator<DeckDrive> deck(DeckDrive{motor1Pin1, motor1Pin2, enable1Pin, pwmChannel, dutyCycle}, ROTATION_DURATION);
+#endif
 
 // Web server
 AsyncWebServer server(80);
 
-// Light state for UI mirroring
-bool uiRoadRed = false;
-bool uiRoadYellow = false;
-bool uiRoadGreen = true;
-bool uiBoatRed = true;
-bool uiBoatYellow = false;
-bool uiBoatGreen = false;
+// Bridges along the channel share boat sightings (corridor.h). Each board
+// is built with its own -DBRIDGE_ID=n and -DBRIDGE_POS_CM=x (along the
+// channel, sensor A facing lower positions).
+#ifndef BRIDGE_ID
+#define BRIDGE_ID 1
+#endif
+#ifndef BRIDGE_POS_CM
+#define BRIDGE_POS_CM 0
+#endif
+BRIDGE_TUNABLE uint8_t CORRIDOR_ID = BRIDGE_ID;
+BRIDGE_TUNABLE int32_t CORRIDOR_POS_CM = BRIDGE_POS_CM;
+BRIDGE_TUNABLE uint16_t CORRIDOR_SPEED_CMS = 20; // assumed until two bridges have timed a boat
+BRIDGE_TUNABLE bool CORRIDOR_STAGING = true;     // open ahead of boats on their way
+Corridor corridor;
+
+// Telemetry pushed to a collector (telemetry.h), off until POST /telemetry
+TelemetryUplink telemetry;
+
+// Control-loop timing (tick-to-tick interval), exposed on /metrics.
+// Cumulative counters only, so readers diff two samples instead of resetting.
+const int TICK_HIST_BUCKETS = 64;  // 5 ms wide, last bucket is open-ended
+const int TICK_HIST_WIDTH_MS = 5;
+std::atomic<uint32_t> tickCount(0);
+std::atomic<uint32_t> tickIntervalSumMs(0);
+std::atomic<uint32_t> tickIntervalMaxMs(0);
+std::atomic<uint32_t> tickHist[TICK_HIST_BUCKETS];
+
+// Observable state version: bumped by loop() whenever anything a status route
+// reports changes, so clients can ask "anything new since version N?"
+std::atomic<uint32_t> stateVersion(1);
+const unsigned long LONG_POLL_MAX_MS = 25000; // cap on ?wait=
+const int MAX_HELD_POLLS = 6;                 // held requests each pin a TCP pcb
+std::atomic<int> heldPolls(0);
+
+// Traffic lamps, red/yellow/green (lamps.h). The UI mirrors their patterns.
+const LampPattern LAMP_WARN_FLASH = lampFlash(1000); // 1 Hz, half on
+Lamp roadLamps[3] = {{redLEDPin_R, 2}, {yellowLEDPin_R, 4}, {greenLEDPin_R, 6}};
+Lamp boatLamps[3] = {{redLEDPin_B, 8}, {yellowLEDPin_B, 10}, {greenLEDPin_B, 12}};
+
+// Event tracing
+// Fixed-size binary events in one ring per core, stamped in microseconds
+// from esp_timer. That clock is shared by both cores; the per-core cycle
+// counters are not in step, so they would misalign cross-core events.
+// Cheap enough to leave on; GET /trace dumps the rings and
+// tools/trace2chrome.cpp turns a dump into Chrome/Perfetto trace JSON.
+#ifndef BRIDGE_TRACE
+#define BRIDGE_TRACE 1
+#endif
+
+enum TraceType : uint8_t
+{
+  TR_TICK_BEGIN = 1,
+  TR_TICK_END,
+  TR_SENSOR_TRIGGER, // a = echo pin
+  TR_SENSOR_ECHO,    // a = echo pin, b = echo us (clipped to 16 bits)
+  TR_STATE,          // a = new MotorState
+  TR_GPIO,           // a = 0 road / 1 boat, b = lamp bits (R=4, Y=2, G=1; flashing << 3)
+  TR_MOTOR,          // a = 0 stop / 1 up / 2 down, b = deck position (per-mille)
+  TR_HTTP_BEGIN,     // a = route id
+  TR_HTTP_END        // a = route id
+};
+
+struct TraceRecord
+{
+  uint32_t us; // esp_timer, low 32 bits
+  uint8_t type;
+  uint8_t a;
+  uint16_t b;
+};
+
+const int TRACE_CORES = 2;
+const uint32_t TRACE_LEN = 1024; // records per core, power of two
+const int TRACE_MAX_ROUTES = 32;
+TraceRecord traceRing[TRACE_CORES][TRACE_LEN];
+std::atomic<uint32_t> traceHead[TRACE_CORES];
+std::atomic<bool> tracePaused(false);
+const char *traceRoutes[TRACE_MAX_ROUTES];
+uint8_t traceRouteCount = 0;
+
+inline void trace(TraceType type, uint8_t a = 0, uint16_t b = 0)
+{
+#if BRIDGE_TRACE
+  if (tracePaused.load(std::memory_order_relaxed))
+    return;
+  int core = xPortGetCoreID() & (TRACE_CORES - 1);
+  uint32_t i = traceHead[core].fetch_add(1, std::memory_order_relaxed);
+  TraceRecord &r = traceRing[core][i & (TRACE_LEN - 1)];
+  r.us = (uint32_t)esp_timer_get_time();
+  r.type = type;
+  r.a = a;
+  r.b = b;
+#else
+  (void)type;
+  (void)a;
+  (void)b;
+#endif
+}
+
+// Every state transition goes through here
+void setState(MotorState s)
+{
+  currentState = s;
+  trace(TR_STATE, (uint8_t)s);
+  int32_t f = s;
+  telemetry.record(TEL_STATE, &f, millis());
+  if (s == FAULT)
+    telemetry.flush(); // worth a wakeup of its own
+}
+
+// Lit R=4, Y=2, G=1; the same bits << 3 for flashing
+uint16_t lampBits(const Lamp (&bank)[3])
+{
+  uint16_t bits = 0;
+  for (int i = 0; i < 3; i++)
+  {
+    uint16_t b = 4 >> i;
+    if (bank[i].pattern().lit())
+      bits |= b;
+    if (bank[i].pattern().flashing())
+      bits |= b << 3;
+  }
+  return bits;
+}
 
-void applyRoad(bool R, bool Y, bool G)
+// Called every tick; the lamps only change (and trace) when a pattern does
+void applyRoad(const LampPattern &R, const LampPattern &Y, const LampPattern &G)
 {
-  uiRoadRed = R;
-  uiRoadYellow = Y;
-  uiRoadGreen = G;
-  digitalWrite(redLEDPin_R, R);
-  digitalWrite(yellowLEDPin_R, Y);
-  digitalWrite(greenLEDPin_R, G);
+  if (roadLamps[0].set(R) | roadLamps[1].set(Y) | roadLamps[2].set(G))
+    trace(TR_GPIO, 0, lampBits(roadLamps));
 }
 
-void applyBoat(bool R, bool Y, bool G)
+void applyBoat(const LampPattern &R, const LampPattern &Y, const LampPattern &G)
 {
-  uiBoatRed = R;
-  uiBoatYellow = Y;
-  uiBoatGreen = G;
-  digitalWrite(redLEDPin_B, R);
-  digitalWrite(yellowLEDPin_B, Y);
-  digitalWrite(greenLEDPin_B, G);
+  if (boatLamps[0].set(R) | boatLamps[1].set(Y) | boatLamps[2].set(G))
+    trace(TR_GPIO, 1, lampBits(boatLamps));
 }
 
+const LampPattern &steady(bool on) { return on ? LAMP_ON : LAMP_OFF; }
+
 // Helper signature preserved (mapping into applyRoad/applyBoat)
 void setLights(bool roadGreen, bool roadRed, bool roadYellow,
                bool boatRed, bool boatYellow, bool boatGreen)
 {
-  applyRoad(roadRed, roadYellow, roadGreen);
-  applyBoat(boatRed, boatYellow, boatGreen);
+  applyRoad(steady(roadRed), steady(roadYellow), steady(roadGreen));
+  applyBoat(steady(boatRed), steady(boatYellow), steady(boatGreen));
+}
+
+// Emergency stop
+// The button ISR and the /stop handler cut the drive themselves with direct
+// register writes (actuator.h), whatever the control loop is doing, and latch
+// the trip. The loop then settles into FAULT and refuses to move the deck
+// until a reset. Every trip records how long the cut took from the moment
+// its caller was entered (ISR or handler), and when it happened on the
+// esp_timer clock, so a tester can time it from the pin edge or from the
+// request leaving the client.
+enum EstopSource : uint8_t
+{
+  ESTOP_NONE,
+  ESTOP_BUTTON,
+  ESTOP_API
+};
+
+const uint32_t ESTOP_BOUND_US = 20;        // button: worst case from the pin edge
+const uint32_t ESTOP_API_BOUND_US = 50000; // POST /stop: from the request being sent
+
+std::atomic<uint8_t> estopLatched(ESTOP_NONE); // source of the first trip
+std::atomic<uint32_t> estopAtMs(0);
+std::atomic<uint32_t> estopTrips(0);
+std::atomic<uint32_t> estopLastCycles(0);
+std::atomic<uint32_t> estopMaxCycles(0);
+std::atomic<uint32_t> estopCutUs(0); // esp_timer, low 32 bits, at the last cut
+
+// Cycle counter that is safe to read in an ISR
+inline uint32_t IRAM_ATTR isrCycles()
+{
+#ifdef BRIDGE_HOST
+  return ESP.getCycleCount();
+#else
+  return cpu_hal_get_cycle_count();
+#endif
 }
 
-// Motor PWM control
-void motorPWM(int duty)
+// entryCycles: isrCycles() on entry to the ISR or handler that tripped
+void IRAM_ATTR estopTrip(EstopSource src, uint32_t entryCycles)
 {
-  ledcWrite(pwmChannel, constrain(duty, 0, 255));
+  deck.emergencyOff();
+  uint32_t dt = isrCycles() - entryCycles;
+  estopCutUs.store((uint32_t)esp_timer_get_time());
+
+  uint8_t none = ESTOP_NONE;
+  if (estopLatched.compare_exchange_strong(none, src))
+    estopAtMs.store(millis());
+  estopTrips.fetch_add(1);
+  estopLastCycles.store(dt);
+  uint32_t max = estopMaxCycles.load();
+  while (dt > max && !estopMaxCycles.compare_exchange_weak(max, dt))
+  {
+  }
 }
 
-void stopMotor()
+void IRAM_ATTR estopISR() { estopTrip(ESTOP_BUTTON, isrCycles()); }
+
+uint32_t cyclesToUs(uint32_t cycles) { return cycles / ESP.getCpuFreqMHz(); }
+
+// Deck motion (see actuator.h). None of these block; deck.update() in
+// loop() stops the drive at the end of travel.
+void moveDeck(uint16_t target, unsigned long now)
 {
-  digitalWrite(motor1Pin1, LOW);
-  digitalWrite(motor1Pin2, LOW);
-  motorPWM(0);
+  // Nothing moves until the fault is reset. A trip landing after this check
+  // still wins: the cut pins are no longer routed to LEDC.
+  if (estopLatched.load() != ESTOP_NONE)
+    return;
+  deck.moveTo(target, now);
+  trace(TR_MOTOR, deck.direction() > 0 ? 1 : (deck.direction() < 0 ? 2 : 0), deck.position());
 }
 
-// Rotate motor forward (open bridge)
-void rotateForward()
+void stopDeck(unsigned long now)
 {
-  digitalWrite(motor1Pin1, LOW);
-  digitalWrite(motor1Pin2, HIGH);
-  motorPWM(dutyCycle);
+  deck.stop(now);
+  trace(TR_MOTOR, 0, deck.position());
 }
 
-// Rotate motor backward (close bridge)
-void rotateBackward()
+
+// Telemetry summaries: per second for the sensors, every 10 s for the loop
+const unsigned long TEL_SUMMARY_MS = 1000;
+const unsigned long TEL_METRICS_MS = 10000;
+
+struct DistanceSummary
+{
+  int32_t samples;
+  int32_t min[2], max[2];
+  int64_t sum[2];
+};
+DistanceSummary telDistance;
+
+void telemetrySample(float a, float b)
 {
-  digitalWrite(motor1Pin1, HIGH);
-  digitalWrite(motor1Pin2, LOW);
-  motorPWM(dutyCycle);
+  const float cm[2] = {a, b};
+  for (int i = 0; i < 2; i++)
+  {
+    int32_t mm = (int32_t)(cm[i] * 10);
+    if (telDistance.samples == 0 || mm < telDistance.min[i])
+      telDistance.min[i] = mm;
+    if (telDistance.samples == 0 || mm > telDistance.max[i])
+      telDistance.max[i] = mm;
+    telDistance.sum[i] += mm;
+  }
+  telDistance.samples++;
 }
 
-// Generalized distance
-float getDistance(int trigPin, int echoPin)
+// Raw echo pulse width in us (0 = no echo within 30 ms)
+long readEchoUs(int trigPin, int echoPin)
 {
+  trace(TR_SENSOR_TRIGGER, echoPin);
   digitalWrite(trigPin, LOW);
   delayMicroseconds(2);
   digitalWrite(trigPin, HIGH);
@@ -146,22 +378,94 @@ float getDistance(int trigPin, int echoPin)
   digitalWrite(trigPin, LOW);
 
   long duration = pulseIn(echoPin, HIGH, 30000);
+  trace(TR_SENSOR_ECHO, echoPin, duration > 0xffff ? 0xffff : (uint16_t)duration);
+  return duration;
+}
+
+float echoToCm(long duration)
+{
   float cm = duration * 0.034f / 2.0f;
   return (cm == 0 || cm > 400) ? 400.0f : cm;
 }
 
-// Boat yellow flasher; also mirrors state for UI
-void flashBoatYellow()
+// Generalized distance
+float getDistance(int trigPin, int echoPin)
+{
+  return echoToCm(readEchoUs(trigPin, echoPin));
+}
+
+// Raw ranging capture (threshold tuning)
+// While capturing, every echo the control loop measures is appended to a
+// preallocated buffer as a delta-encoded record:
+//   varint((dt_us << 1) | sensor)   dt_us = trigger time minus previous record's
+//   varint(zigzag(echo_us - previous echo_us of the same sensor))
+// Download framing (see /capture/data, decoded by tools/capture2csv.cpp):
+//   "BRC1", u32 start_us, u32 records, u32 dropped (little endian), records
+const size_t CAPTURE_BYTES = 32768;
+const size_t CAPTURE_HEADER_BYTES = 16;
+const size_t CAPTURE_MAX_RECORD = 10; // two 5-byte varints
+uint8_t captureBuf[CAPTURE_BYTES];
+std::atomic<bool> capturing(false);
+std::atomic<uint32_t> captureLen(0);
+std::atomic<uint32_t> captureRecords(0);
+std::atomic<uint32_t> captureDropped(0);
+std::atomic<int> captureReaders(0); // downloads in flight; no restart meanwhile
+uint32_t captureStartUs = 0;
+uint32_t captureLastUs = 0;
+long captureLastEcho[2] = {0, 0};
+
+size_t putVarint(uint8_t *p, uint32_t v)
+{
+  size_t n = 0;
+  while (v >= 0x80)
+  {
+    p[n++] = (uint8_t)(v | 0x80);
+    v >>= 7;
+  }
+  p[n++] = (uint8_t)v;
+  return n;
+}
+
+// Control loop only. The buffer is claimed (capturing set) before looking
+// for readers, and a download takes its reader slot before looking at
+// capturing, so with both seq_cst one of the two always sees the other.
+// False, with nothing touched, while a download is in flight.
+bool startCapture()
+{
+  bool was = capturing.exchange(true);
+  if (captureReaders.load() > 0)
+  {
+    capturing.store(was);
+    return false;
+  }
+  captureLen.store(0);
+  captureRecords.store(0);
+  captureDropped.store(0);
+  captureStartUs = micros();
+  captureLastUs = captureStartUs;
+  captureLastEcho[0] = captureLastEcho[1] = 0;
+  return true;
+}
+
+// Control loop only. A few byte stores, so the sampling cadence is unchanged.
+void captureEcho(int sensor, uint32_t triggerUs, long echoUs)
 {
-  static unsigned long lastFlashTime = 0;
-  static bool yellowState = false;
-  if (millis() - lastFlashTime >= 500)
+  if (!capturing.load(std::memory_order_relaxed))
+    return;
+  uint32_t len = captureLen.load(std::memory_order_relaxed);
+  if (len + CAPTURE_MAX_RECORD > CAPTURE_BYTES)
   {
-    yellowState = !yellowState;
-    digitalWrite(yellowLEDPin_B, yellowState);
-    uiBoatYellow = yellowState; // mirror to UI
-    lastFlashTime = millis();
+    captureDropped.fetch_add(1, std::memory_order_relaxed);
+    return;
   }
+  int32_t delta = (int32_t)(echoUs - captureLastEcho[sensor]);
+  uint8_t *p = captureBuf + len;
+  size_t n = putVarint(p, ((triggerUs - captureLastUs) << 1) | (uint32_t)sensor);
+  n += putVarint(p + n, ((uint32_t)delta << 1) ^ (uint32_t)(delta >> 31));
+  captureLastUs = triggerUs;
+  captureLastEcho[sensor] = echoUs;
+  captureRecords.fetch_add(1, std::memory_order_relaxed);
+  captureLen.store(len + n, std::memory_order_release);
 }
 
 // State -> string for UI
@@ -181,343 +485,1678 @@ const char *stateString(MotorState s)
     return "OPEN";
   case BRIDGE_CLOSING:
     return "CLOSING";
+  case FAULT:
+    return "FAULT";
   }
   return "UNKNOWN";
 }
 
-// HTTP Routes 
-void setupRoutes()
+// Wi-Fi link (background)
+// The control loop runs from the first tick; the station connects on its own
+// and the web server starts the first time the link comes up. The last good
+// BSSID/channel is kept in RTC memory so a reset can skip the scan.
+enum LinkState
 {
-  DefaultHeaders::Instance().addHeader("Access-Control-Allow-Origin", "*");
+  LINK_DOWN,
+  LINK_CONNECTING,
+  LINK_UP
+};
 
-  // Mode GET
-  server.on("/mode", HTTP_GET, [](AsyncWebServerRequest *req)
-            {
-    String json = String("{\"value\":\"") + (manualMode ? "manual" : "auto") + "\"}";
-    req->send(200, "application/json", json); });
+const unsigned long WIFI_ATTEMPT_MS = 8000;      // give up on one join attempt
+const unsigned long WIFI_BACKOFF_MIN_MS = 1000;  // then wait, doubling ...
+const unsigned long WIFI_BACKOFF_MAX_MS = 60000; // ... up to a minute
+const unsigned long FIRST_TICK_BUDGET_MS = 250;  // boot -> first control tick
+const uint32_t WIFI_CACHE_MAGIC = 0xB51D6E64;
 
-  // Mode POST
-  server.on("/mode", HTTP_POST, [](AsyncWebServerRequest *req)
-            {
-    if (!req->hasParam("value")) {
-      req->send(400, "text/plain", "missing value");
-      return;
-    }
-    String v = req->getParam("value")->value();
-    v.toLowerCase();
-    if (v == "manual")      manualMode = true;
-    else if (v == "auto")   manualMode = false;
-    else {
-      req->send(400, "text/plain", "invalid value");
-      return;
-    }
-    stopMotor();
-    currentState = IDLE;
-    req->send(200, "text/plain", "OK"); });
+struct WiFiCache
+{
+  uint32_t magic;
+  uint8_t bssid[6];
+  int32_t channel;
+};
+RTC_NOINIT_ATTR WiFiCache wifiCache;
 
-  // Manual open/close (only if manualMode)
-  server.on("/led/on", HTTP_ANY, [](AsyncWebServerRequest *req) { // OPEN
-    if (!manualMode)
+LinkState linkState = LINK_DOWN;
+bool linkFastAttempt = false;
+unsigned long linkAttemptStart = 0;
+unsigned long linkRetryAt = 0;
+unsigned long linkBackoffMs = WIFI_BACKOFF_MIN_MS;
+bool serverStarted = false;
+unsigned long firstTickMs = 0; // millis() at the first control tick
+unsigned long linkUpMs = 0;    // millis() when the link first came up
+
+void setupRoutes();
+
+void beginWiFiAttempt(unsigned long now)
+{
+  linkFastAttempt = (wifiCache.magic == WIFI_CACHE_MAGIC);
+  if (linkFastAttempt)
+    WiFi.begin(WIFI_SSID, WIFI_PASS, wifiCache.channel, wifiCache.bssid);
+  else
+    WiFi.begin(WIFI_SSID, WIFI_PASS);
+  linkAttemptStart = now;
+  linkState = LINK_CONNECTING;
+  Serial.println(linkFastAttempt ? "WiFi connecting (cached BSSID)" : "WiFi connecting");
+}
+
+// Called every tick; never blocks
+void serviceWiFi(unsigned long now)
+{
+  switch (linkState)
+  {
+  case LINK_DOWN:
+    if ((long)(now - linkRetryAt) >= 0)
+      beginWiFiAttempt(now);
+    break;
+
+  case LINK_CONNECTING:
+    if (WiFi.status() == WL_CONNECTED)
     {
-      req->send(403, "text/plain", "Manual mode required");
-      return;
+      linkState = LINK_UP;
+      linkBackoffMs = WIFI_BACKOFF_MIN_MS;
+      memcpy(wifiCache.bssid, WiFi.BSSID(), sizeof(wifiCache.bssid));
+      wifiCache.channel = WiFi.channel();
+      wifiCache.magic = WIFI_CACHE_MAGIC;
+      Serial.print("WiFi IP: ");
+      Serial.println(WiFi.localIP());
+      if (!serverStarted)
+      {
+        linkUpMs = now;
+        configTime(0, 0, "pool.ntp.org"); // wall clock for ?at= bookings
+        if (!corridor.begin(CORRIDOR_ID, CORRIDOR_POS_CM, CORRIDOR_SPEED_CMS))
+          Serial.println("Corridor socket failed, sightings not shared");
+        setupRoutes();
+        server.begin();
+        serverStarted = true;
+        Serial.println("HTTP server started");
+      }
     }
-    rotateForward();
-    rotationStartTime = millis();
-    currentState = BRIDGE_OPENING;
-    req->send(200, "text/plain", "OPENING");
-  });
+    else if (now - linkAttemptStart >= WIFI_ATTEMPT_MS)
+    {
+      WiFi.disconnect();
+      if (linkFastAttempt)
+      {
+        // AP may have moved channel: forget it and scan right away
+        wifiCache.magic = 0;
+        linkRetryAt = now;
+      }
+      else
+      {
+        linkRetryAt = now + linkBackoffMs;
+        Serial.print("WiFi timeout, retry in ");
+        Serial.print(linkBackoffMs);
+        Serial.println(" ms");
+        linkBackoffMs = linkBackoffMs * 2 > WIFI_BACKOFF_MAX_MS ? WIFI_BACKOFF_MAX_MS : linkBackoffMs * 2;
+      }
+      linkState = LINK_DOWN;
+    }
+    break;
 
-  server.on("/led/off", HTTP_ANY, [](AsyncWebServerRequest *req) { // CLOSE
-    if (!manualMode)
+  case LINK_UP:
+    if (WiFi.status() != WL_CONNECTED)
     {
-      req->send(403, "text/plain", "Manual mode required");
-      return;
+      Serial.println("WiFi lost, reconnecting");
+      linkRetryAt = now;
+      linkState = LINK_DOWN;
     }
-    rotateBackward();
-    rotationStartTime = millis();
-    currentState = BRIDGE_CLOSING;
-    req->send(200, "text/plain", "CLOSING");
-  });
+    break;
+  }
+}
 
-  server.on("/stop", HTTP_ANY, [](AsyncWebServerRequest *req)
-            {
-    stopMotor();
-    currentState = IDLE;
-    req->send(200, "text/plain", "STOPPED"); });
+// Command mailbox (HTTP -> control loop)
+// Handlers never touch currentState, the timers or the motor pins. They push a
+// command into this bounded lock-free MPSC ring and return straight away;
+// loop() drains it once per tick. The sequence number of a command is its ring
+// position + 1, so commands are applied in seq order and a client can tell a
+// command has taken effect once cmdAppliedSeq has reached it.
+// The one exception is /stop: waiting for the next tick is too slow for a
+// stop, so its handler cuts the drive itself (register writes only, see
+// estopTrip) and leaves the state change to the loop.
+enum CommandType : uint8_t
+{
+  CMD_NONE,
+  CMD_MODE_AUTO,
+  CMD_MODE_MANUAL,
+  CMD_OPEN,
+  CMD_CLOSE,
+  CMD_FAULT_RESET,
+  CMD_CAPTURE_START,
+  CMD_CAPTURE_STOP,
+  CMD_RESERVE, // args: id, open time (millis), hold ms
+  CMD_CANCEL,  // args: id
+  CMD_TELEMETRY, // args: collector IPv4, port (0 = off), batch ms
+  CMD_COUNT
+};
 
-  // Live measurements
-  server.on("/distance", HTTP_GET, [](AsyncWebServerRequest *req)
-            {
-    float a = getDistance(trigPin_A, echoPin_A);
-    float b = getDistance(trigPin_B, echoPin_B);
-    String json = String("{\"A\":") + String(a, 1) + ",\"B\":" + String(b, 1) + "}";
-    req->send(200, "application/json", json); });
+enum EnqueueResult
+{
+  ENQ_QUEUED,
+  ENQ_COALESCED, // same command already waiting, its seq is returned
+  ENQ_CONFLICT,  // opposite command already waiting
+  ENQ_FULL
+};
 
-  // Traffic light mirror for UI
-  server.on("/lights", HTTP_GET, [](AsyncWebServerRequest *req)
-            {
-    String json = String("{\"road\":{\"red\":")  + (uiRoadRed ? 1 : 0) +
-                  ",\"yellow\":" + (uiRoadYellow ? 1 : 0) +
-                  ",\"green\":"  + (uiRoadGreen ? 1 : 0) +
-                  "},\"boat\":{\"red\":" + (uiBoatRed ? 1 : 0) +
-                  ",\"yellow\":" + (uiBoatYellow ? 1 : 0) +
-                  ",\"green\":"  + (uiBoatGreen ? 1 : 0) + "}}";
-    req->send(200, "application/json", json); });
+const int CMD_ARGS = 3;
 
-  // Bridge state
-  server.on("/state", HTTP_GET, [](AsyncWebServerRequest *req)
-            {
-    String json = String("{\"state\":\"") + stateString(currentState) + "\"}";
-    req->send(200, "application/json", json); });
+struct CommandSlot
+{
+  std::atomic<uint32_t> turn; // == pos: free for producer, == pos + 1: filled
+  CommandType type;
+  uint32_t args[CMD_ARGS];
+};
 
-  // Timers endpoint: remaining time for road + boat phases
-  server.on("/timers", HTTP_GET, [](AsyncWebServerRequest *req)
-            {
-    unsigned long now = millis();
+const uint32_t CMD_QUEUE_LEN = 16; // must be a power of two
+CommandSlot cmdQueue[CMD_QUEUE_LEN];
+std::atomic<uint32_t> cmdTail(0);               // next position producers claim
+uint32_t cmdHead = 0;                           // next position to drain (loop only)
+std::atomic<uint32_t> cmdPendingSeq[CMD_COUNT]; // queued, not yet applied (0 = none)
+std::atomic<uint32_t> cmdAppliedSeq(0);         // every seq <= this has been applied
 
-    long roadRemainMs = 0;
-    long boatRemainMs = 0;
+void initCommandQueue()
+{
+  for (uint32_t i = 0; i < CMD_QUEUE_LEN; i++)
+    cmdQueue[i].turn.store(i, std::memory_order_relaxed);
+  for (int t = 0; t < CMD_COUNT; t++)
+    cmdPendingSeq[t].store(0, std::memory_order_relaxed);
+}
 
-    // ROAD timer: only during ROAD_WARNING
-    if (currentState == ROAD_WARNING) {
-      unsigned long elapsed = now - yellowStartTime;
-      if (elapsed < ROAD_WARNING_MS) {
-        roadRemainMs = (long)(ROAD_WARNING_MS - elapsed);
-      }
-    }
+CommandType conflictingCommand(CommandType type)
+{
+  switch (type)
+  {
+  case CMD_MODE_AUTO:
+    return CMD_MODE_MANUAL;
+  case CMD_MODE_MANUAL:
+    return CMD_MODE_AUTO;
+  case CMD_OPEN:
+    return CMD_CLOSE;
+  case CMD_CLOSE:
+    return CMD_OPEN;
+  case CMD_CAPTURE_START:
+    return CMD_CAPTURE_STOP;
+  case CMD_CAPTURE_STOP:
+    return CMD_CAPTURE_START;
+  default:
+    return CMD_NONE;
+  }
+}
 
-    // BOAT / BRIDGE timer
-    if (currentState == BOAT_WARNING) {
-      // 3s boat yellow before opening
-      unsigned long elapsed = now - yellowStartTime;
-      if (elapsed < BOAT_WARNING_MS) {
-        boatRemainMs = (long)(BOAT_WARNING_MS - elapsed);
-      }
-    } else if (currentState == BRIDGE_OPENING) {
-      // time left to fully open
-      unsigned long elapsed = now - rotationStartTime;
-      if (elapsed < ROTATION_DURATION) {
-        boatRemainMs = (long)(ROTATION_DURATION - elapsed);
-      }
-    } else if (currentState == BRIDGE_OPEN && boatClearTime != 0) {
-      // clear-window countdown before closing (6s)
-      unsigned long elapsed = now - boatClearTime;
-      if (elapsed < CLEAR_WINDOW_MS) {
-        boatRemainMs = (long)(CLEAR_WINDOW_MS - elapsed);
-      }
-    } else if (currentState == BRIDGE_CLOSING) {
-      // 3s boat warning, then motor down for ROTATION_DURATION
-      unsigned long warnElapsed = now - yellowStartTime;
-
-      if (warnElapsed < BOAT_WARNING_MS) {
-        boatRemainMs = (long)(BOAT_WARNING_MS - warnElapsed);   // still warning
-      } else {
-        // in the closing movement phase
-        unsigned long moveElapsed = now - rotationStartTime;
-        if (moveElapsed < ROTATION_DURATION) {
-          boatRemainMs = (long)(ROTATION_DURATION - moveElapsed);
-        }
+// Commands carrying arguments are each distinct: never coalesced or tracked
+// as pending
+bool commandHasArgs(CommandType type)
+{
+  return type == CMD_RESERVE || type == CMD_CANCEL || type == CMD_TELEMETRY;
+}
+
+// Safe to call from any task. Coalescing/conflict checks are best effort
+// between two producers racing each other; applyCommand() is idempotent, so
+// the worst case is a duplicate being applied twice.
+EnqueueResult enqueueCommand(CommandType type, uint32_t &seq, const uint32_t *args = nullptr)
+{
+  bool hasArgs = commandHasArgs(type);
+  uint32_t pending = hasArgs ? 0 : cmdPendingSeq[type].load(std::memory_order_acquire);
+  if (pending != 0)
+  {
+    seq = pending;
+    return ENQ_COALESCED;
+  }
+  CommandType other = conflictingCommand(type);
+  if (other != CMD_NONE && cmdPendingSeq[other].load(std::memory_order_acquire) != 0)
+    return ENQ_CONFLICT;
+
+  uint32_t pos = cmdTail.load(std::memory_order_relaxed);
+  for (;;)
+  {
+    CommandSlot &slot = cmdQueue[pos & (CMD_QUEUE_LEN - 1)];
+    int32_t diff = (int32_t)(slot.turn.load(std::memory_order_acquire) - pos);
+    if (diff == 0)
+    {
+      if (cmdTail.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+      {
+        slot.type = type;
+        for (int i = 0; i < CMD_ARGS; i++)
+          slot.args[i] = args ? args[i] : 0;
+        seq = pos + 1;
+        if (!hasArgs)
+          cmdPendingSeq[type].store(seq, std::memory_order_release);
+        slot.turn.store(pos + 1, std::memory_order_release);
+        return ENQ_QUEUED;
       }
     }
+    else if (diff < 0)
+    {
+      return ENQ_FULL;
+    }
+    else
+    {
+      pos = cmdTail.load(std::memory_order_relaxed);
+    }
+  }
+}
 
-    String json = "{";
-    json += "\"road\":{\"remaining_ms\":" + String(roadRemainMs) + "},";
-    json += "\"boat\":{\"remaining_ms\":" + String(boatRemainMs) + "}";
-    json += "}";
+// Reservations
+// Booked openings (POST /reservations). The deck must be fully open at the
+// booked time, so auto mode starts the road warning a lead time earlier and
+// holds the bridge open for the booking. Bookings that overlap, or leave too
+// short a gap to close and reopen, merge into one opening; a boat seen by
+// the sensors meanwhile just joins it. The table is a small array sorted by
+// opening time, touched by the control loop only (handlers queue commands).
+const int RESV_MAX = 8;
+const unsigned long RESV_HOLD_DEFAULT_MS = 60000;  // open for a minute unless told
+const unsigned long RESV_HOLD_MAX_MS = 3600000;    // an hour at most
+const unsigned long RESV_HORIZON_MS = 86400000;    // book up to a day ahead
 
-    req->send(200, "application/json", json); });
+struct Reservation
+{
+  uint32_t id;
+  unsigned long openAtMs; // millis() when the deck must be fully open
+  unsigned long holdMs;   // then stays open this long
+};
 
-  // Serve UI
-  server.serveStatic("/", SPIFFS, "/").setDefaultFile("index.html");
+Reservation resv[RESV_MAX];
+int resvCount = 0;
+uint32_t resvGen = 0;                  // bumped on every table change
+std::atomic<uint32_t> resvNextId(1);   // handlers hand out ids
+std::atomic<uint32_t> resvDropped(0);  // bookings lost to a full table
 
-  server.onNotFound([](AsyncWebServerRequest *req)
-                    {
-    if (req->method() == HTTP_OPTIONS) req->send(200);
-    else req->send(404, "text/plain", "Not found"); });
+const int RESV_TICK_EDGES = 4; // phase changes on the way up, each seen on a tick
+
+// From the start of the road warning to fully open. Every phase change waits
+// for the next tick, so start that many mean ticks early: the deck is up by
+// the booked time rather than a few hundred ms after it.
+unsigned long resvLeadMs()
+{
+  uint32_t ticks = tickCount.load(std::memory_order_relaxed);
+  unsigned long slack = ticks ? RESV_TICK_EDGES * tickIntervalSumMs.load(std::memory_order_relaxed) / ticks : 0;
+  return ROAD_WARNING_MS + BOAT_WARNING_MS + ROTATION_DURATION + slack;
 }
 
-void setup()
+// Closing, then the lead to open again: a shorter gap keeps the deck up
+unsigned long resvCycleMs()
 {
-  Serial.begin(115200);
-  Serial.println("Bridge + Boat Traffic (WiFi + UI mirror)");
+  return BOAT_WARNING_MS + ROTATION_DURATION + resvLeadMs();
+}
 
-  // Pins
-  pinMode(motor1Pin1, OUTPUT);
-  pinMode(motor1Pin2, OUTPUT);
-  ledcSetup(pwmChannel, pwmFreq, pwmResBits);
-  ledcAttachPin(enable1Pin, pwmChannel);
-  stopMotor();
-
-  pinMode(redLEDPin_R, OUTPUT);
-  pinMode(yellowLEDPin_R, OUTPUT);
-  pinMode(greenLEDPin_R, OUTPUT);
-  pinMode(redLEDPin_B, OUTPUT);
-  pinMode(yellowLEDPin_B, OUTPUT);
-  pinMode(greenLEDPin_B, OUTPUT);
+bool addReservation(uint32_t id, unsigned long openAtMs, unsigned long holdMs)
+{
+  if (resvCount == RESV_MAX)
+    return false;
+  int i = resvCount++;
+  for (; i > 0 && (long)(resv[i - 1].openAtMs - openAtMs) > 0; i--)
+    resv[i] = resv[i - 1];
+  resv[i] = {id, openAtMs, holdMs};
+  resvGen++;
+  return true;
+}
 
-  pinMode(trigPin_A, OUTPUT);
-  pinMode(echoPin_A, INPUT);
-  pinMode(trigPin_B, OUTPUT);
-  pinMode(echoPin_B, INPUT);
+void removeReservation(int i)
+{
+  for (resvCount--; i < resvCount; i++)
+    resv[i] = resv[i + 1];
+  resvGen++;
+}
 
-  pinMode(whiteLEDPin, OUTPUT);
-  digitalWrite(whiteLEDPin, HIGH); // turn on
+void cancelReservation(uint32_t id)
+{
+  for (int i = 0; i < resvCount; i++)
+    if (resv[i].id == id)
+    {
+      removeReservation(i);
+      return;
+    }
+}
 
-  // Initial: road green, boat red
-  setLights(true, false, false, true, false, false);
+// Drop bookings whose hold has run out
+void expireReservations(unsigned long now)
+{
+  for (int i = 0; i < resvCount;)
+    if ((long)(now - (resv[i].openAtMs + resv[i].holdMs)) >= 0)
+      removeReservation(i);
+    else
+      i++;
+}
 
-  // SPIFFS
-  if (!SPIFFS.begin(true))
-    Serial.println("SPIFFS mount failed");
-  else
-    Serial.println("SPIFFS mounted");
+// The next opening, merged: open at openAt, keep open until `until`
+bool nextWindow(unsigned long &openAt, unsigned long &until)
+{
+  if (resvCount == 0)
+    return false;
+  openAt = resv[0].openAtMs;
+  until = openAt + resv[0].holdMs;
+  for (int i = 1; i < resvCount && (long)(resv[i].openAtMs - (until + resvCycleMs())) < 0; i++)
+    if ((long)(resv[i].openAtMs + resv[i].holdMs - until) > 0)
+      until = resv[i].openAtMs + resv[i].holdMs;
+  return true;
+}
 
-  // WiFi
-  WiFi.mode(WIFI_STA);
-  WiFi.begin(WIFI_SSID, WIFI_PASS);
-  Serial.print("Connecting to WiFi");
-  uint32_t t0 = millis();
-  while (WiFi.status() != WL_CONNECTED && millis() - t0 < 20000)
-  {
-    Serial.print('.');
-    delay(300);
-  }
-  Serial.println();
-  if (WiFi.status() != WL_CONNECTED)
+// Time to start the road warning for the next opening
+bool reservationDue(unsigned long now)
+{
+  unsigned long openAt, until;
+  return nextWindow(openAt, until) && (long)(openAt - resvLeadMs() - now) <= 0;
+}
+
+// The deck must stay up: the opening is on, or closing now would not leave
+// time to open again for it
+bool reservationHolds(unsigned long now)
+{
+  unsigned long openAt, until;
+  return nextWindow(openAt, until) && (long)(openAt - now) < (long)resvCycleMs();
+}
+
+// Boats on their way (corridor.h) get a booking like any other: the deck is
+// open by the ETA less a margin for the speed changing since the last
+// sighting, and held as long again after it. The booking goes when the boat
+// reaches our own sensors; from then on they keep the deck up.
+const uint32_t CORR_RESV_ID = 0x80000000; // | track id
+const unsigned long CORR_MARGIN_MS = 2000;
+const int CORR_MARGIN_PCT = 20;                // of the travel time from the last sighting
+const unsigned long CORR_HORIZON_MS = 600000;  // further out than this: not yet
+
+// Books or moves reservation id; unchanged bookings are left alone
+void bookReservation(uint32_t id, unsigned long openAtMs, unsigned long holdMs)
+{
+  for (int i = 0; i < resvCount; i++)
+    if (resv[i].id == id)
+    {
+      if (resv[i].openAtMs == openAtMs && resv[i].holdMs == holdMs)
+        return;
+      removeReservation(i);
+      break;
+    }
+  if (!addReservation(id, openAtMs, holdMs))
+    resvDropped.fetch_add(1, std::memory_order_relaxed);
+}
+
+void stageCorridor(unsigned long now)
+{
+  for (int i = 0; i < corridor.trackCount(); i++)
   {
-    Serial.println("WiFi timeout, rebooting in 3s");
-    delay(3000);
-    ESP.restart();
+    const CorridorTrack &t = corridor.track(i);
+    uint32_t id = CORR_RESV_ID | t.id;
+    if (t.passed || !CORRIDOR_STAGING)
+    {
+      cancelReservation(id);
+      continue;
+    }
+    long travel = t.travelMs(CORRIDOR_POS_CM);
+    long eta = t.etaMs(CORRIDOR_POS_CM, now);
+    if (travel <= 0 || eta <= 0 || eta > (long)CORR_HORIZON_MS)
+      continue; // not coming, or late: an existing booking runs out on its own
+    unsigned long margin = CORR_MARGIN_MS + travel * CORR_MARGIN_PCT / 100;
+    unsigned long arrive = t.seenMs + travel;
+    bookReservation(id, arrive - margin, 2 * margin);
   }
-  Serial.print("WiFi IP: ");
-  Serial.println(WiFi.localIP());
+}
 
-  setupRoutes();
-  server.begin();
-  Serial.println("HTTP server started");
+// Telemetry device id: the last four bytes of the MAC
+uint32_t deviceId()
+{
+  return (uint32_t)(ESP.getEfuseMac() >> 16);
 }
 
-void loop() // Automatic Mode (state machine)
+// Where the state machine picks up after a mode change or a fault reset.
+// A deck left fully up is handed over as open, so auto mode closes it
+// properly. Part-way up, auto mode closes it through the closing warning
+// straight away: boat green needs the deck fully open. So does a deck
+// that is at an end only on paper after a reset (slack).
+MotorState settledState(unsigned long now)
 {
-  // Sample distances
-  static unsigned long tSense = 0;
-  unsigned long now = millis();
-  if (now - tSense >= 120)
+  bool sure = deck.slackMs() == 0;
+  if (deck.position() == DECK_CLOSED && sure)
+    return IDLE;
+  if ((deck.position() == DECK_OPEN && sure) || manualMode)
+    return BRIDGE_OPEN;
+  yellowStartTime = now;
+  return BRIDGE_CLOSING;
+}
+
+// A trip lands from the ISR or the /stop handler at any time; until the
+// loop enters FAULT for it, commands must already treat it as one
+bool faulted()
+{
+  return currentState == FAULT || estopLatched.load() != ESTOP_NONE;
+}
+
+void applyCommand(CommandType type, const uint32_t *args, unsigned long now)
+{
+  switch (type)
   {
-    distanceA = getDistance(trigPin_A, echoPin_A);
-    distanceB = getDistance(trigPin_B, echoPin_B);
-    tSense = now;
+  case CMD_MODE_AUTO:
+  case CMD_MODE_MANUAL:
+  {
+    bool manual = (type == CMD_MODE_MANUAL);
+    if (manual == manualMode)
+      break; // re-asserting the current mode leaves the bridge alone
+    manualMode = manual;
+    if (faulted())
+      break; // a mode change does not clear a fault
+    stopDeck(now);
+    setState(settledState(now));
+    break;
   }
 
-  // AUTO state machine
-  if (!manualMode)
-  {
-    switch (currentState)
-    {
-    case IDLE:
-      // Road GREEN, Boat RED
-      setLights(true, false, false, true, false, false);
-      if (distanceA <= 50 || distanceB <= 50)
-      {
-        yellowStartTime = now;
-        currentState = ROAD_WARNING;
-        Serial.println("Boat detected -> ROAD_WARNING START");
-      }
+  case CMD_OPEN:
+    // Repeats are harmless: moveTo() keeps a move already under way
+    if (!manualMode || faulted())
       break;
+    moveDeck(DECK_OPEN, now);
+    setState(deck.moving() ? BRIDGE_OPENING : BRIDGE_OPEN);
+    break;
 
-    case ROAD_WARNING:
-      // Road YELLOW, Boat RED
-      setLights(false, false, true, true, false, false);
-      if (now - yellowStartTime >= ROAD_WARNING_MS)
-      {
-        yellowStartTime = now;
-        currentState = BOAT_WARNING;
-        Serial.println("Road warned -> BOAT_WARNING START");
-      }
+  case CMD_CLOSE:
+    if (!manualMode || faulted())
       break;
+    moveDeck(DECK_CLOSED, now);
+    setState(deck.moving() ? BRIDGE_CLOSING : IDLE);
+    break;
 
-    case BOAT_WARNING:
-      // Road RED; Boat RED + YELLOW flashing
-      applyRoad(true, false, false); // road red on
-      applyBoat(true, false, false); // boat red on
-      flashBoatYellow();             // flash boat yellow
-      if (now - yellowStartTime >= BOAT_WARNING_MS)
-      {
-        rotateForward();
-        rotationStartTime = now;
-        digitalWrite(yellowLEDPin_B, LOW);
-        uiBoatYellow = false;
-        currentState = BRIDGE_OPENING;
-        Serial.println("Opening bridge");
-      }
+  case CMD_FAULT_RESET:
+    // Not while the button is still pressed
+    if (currentState != FAULT || digitalRead(estopPin) == LOW)
       break;
+    estopLatched.store(ESTOP_NONE);
+    deck.rearm();
+    setState(settledState(now));
+    Serial.println("E-stop reset");
+    break;
 
-    case BRIDGE_OPENING:
-      // Both RED; boat yellow flashing while moving
-      applyRoad(true, false, false);
-      applyBoat(true, false, false);
-      flashBoatYellow();
-      if (now - rotationStartTime >= ROTATION_DURATION)
-      {
-        stopMotor();
-        // Road RED, Boat GREEN
-        setLights(false, true, false, false, false, true);
-        uiBoatYellow = false;
-        digitalWrite(yellowLEDPin_B, LOW);
-        currentState = BRIDGE_OPEN;
-        Serial.println("Bridge open -> Boat GREEN START");
-      }
-      break;
+  case CMD_CAPTURE_START:
+    startCapture();
+    break;
 
-    case BRIDGE_OPEN:
-      // Road RED, Boat GREEN
-      setLights(false, true, false, false, false, true);
-      // If no boat for 6s → close
-      if (distanceA > 70 && distanceB > 70)
-      {
-        if (boatClearTime == 0)
-        {
-          boatClearTime = now;
-          Serial.println("No Boat Detected -> 6s wait before closing");
-        }
-        else if (now - boatClearTime >= CLEAR_WINDOW_MS)
-        {
-          yellowStartTime = now;
-          currentState = BRIDGE_CLOSING;
-          boatClearTime = 0;
-          Serial.println("Closing sequence start");
-        }
-      }
-      else
+  case CMD_CAPTURE_STOP:
+    capturing.store(false, std::memory_order_release);
+    break;
+
+  case CMD_RESERVE:
+    if (!addReservation(args[0], args[1], args[2]))
+    {
+      resvDropped.fetch_add(1, std::memory_order_relaxed);
+      Serial.println("Reservation table full, booking dropped");
+    }
+    break;
+
+  case CMD_CANCEL:
+    cancelReservation(args[0]);
+    break;
+
+  case CMD_TELEMETRY:
+    telemetry.configure(deviceId(), IPAddress(args[0] >> 24, args[0] >> 16, args[0] >> 8, args[0]), (uint16_t)args[1],
+                        args[2]);
+    break;
+
+  default:
+    break;
+  }
+}
+
+// Control loop side: apply everything queued so far, in order
+void drainCommands(unsigned long now)
+{
+  for (;;)
+  {
+    CommandSlot &slot = cmdQueue[cmdHead & (CMD_QUEUE_LEN - 1)];
+    if (slot.turn.load(std::memory_order_acquire) != cmdHead + 1)
+      break;
+    CommandType type = slot.type;
+    uint32_t args[CMD_ARGS];
+    memcpy(args, slot.args, sizeof(args));
+    uint32_t seq = cmdHead + 1;
+    slot.turn.store(cmdHead + CMD_QUEUE_LEN, std::memory_order_release);
+    cmdHead++;
+
+    applyCommand(type, args, now);
+
+    uint32_t expected = seq;
+    cmdPendingSeq[type].compare_exchange_strong(expected, 0, std::memory_order_acq_rel);
+    cmdAppliedSeq.store(seq, std::memory_order_release);
+  }
+}
+
+// Queue a command and answer with its seq (202) without waiting for it
+void sendCommand(AsyncWebServerRequest *req, CommandType type, const char *status, const uint32_t *args = nullptr,
+                 const String &extra = String())
+{
+  uint32_t seq = 0;
+  EnqueueResult r = enqueueCommand(type, seq, args);
+  if (r == ENQ_CONFLICT)
+  {
+    req->send(409, "text/plain", "conflicting command pending");
+    return;
+  }
+  if (r == ENQ_FULL)
+  {
+    req->send(503, "text/plain", "command queue full");
+    return;
+  }
+  String json = String("{\"status\":\"") + status + "\",\"seq\":" + String(seq) +
+                ",\"coalesced\":" + (r == ENQ_COALESCED ? "true" : "false") + extra + "}";
+  req->send(202, "application/json", json);
+}
+
+// Remaining time for road + boat phases
+void computeTimers(unsigned long now, long &roadRemainMs, long &boatRemainMs)
+{
+  roadRemainMs = 0;
+  boatRemainMs = 0;
+
+  // ROAD timer: only during ROAD_WARNING
+  if (currentState == ROAD_WARNING) {
+    unsigned long elapsed = now - yellowStartTime;
+    if (elapsed < ROAD_WARNING_MS) {
+      roadRemainMs = (long)(ROAD_WARNING_MS - elapsed);
+    }
+  }
+
+  // BOAT / BRIDGE timer
+  if (currentState == BOAT_WARNING) {
+    // 3s boat yellow before opening
+    unsigned long elapsed = now - yellowStartTime;
+    if (elapsed < BOAT_WARNING_MS) {
+      boatRemainMs = (long)(BOAT_WARNING_MS - elapsed);
+    }
+  } else if (currentState == BRIDGE_OPENING) {
+    // time left to fully open
+    boatRemainMs = (long)deck.remainingMs(now);
+  } else if (currentState == BRIDGE_OPEN && reservationHolds(now)) {
+    // booked opening: time until it ends
+    unsigned long openAt, until;
+    nextWindow(openAt, until);
+    boatRemainMs = (long)(until - now);
+  } else if (currentState == BRIDGE_OPEN && boatClearTime != 0) {
+    // clear-window countdown before closing (6s)
+    unsigned long elapsed = now - boatClearTime;
+    if (elapsed < CLEAR_WINDOW_MS) {
+      boatRemainMs = (long)(CLEAR_WINDOW_MS - elapsed);
+    }
+  } else if (currentState == BRIDGE_CLOSING) {
+    // 3s boat warning, then motor down for ROTATION_DURATION
+    unsigned long warnElapsed = now - yellowStartTime;
+
+    if (warnElapsed < BOAT_WARNING_MS) {
+      boatRemainMs = (long)(BOAT_WARNING_MS - warnElapsed);   // still warning
+    } else {
+      // in the closing movement phase
+      boatRemainMs = (long)deck.remainingMs(now);
+    }
+  }
+}
+
+// Status snapshot
+// Once per tick the control loop serialises every status body into one of
+// three fixed buffers and publishes it with an index swap. Handlers copy
+// bytes out of the newest one, so N dashboards cost N copies rather than N
+// formatting passes, and no body mixes two ticks. All readers run on the
+// async_tcp task: a single reader, which is what the triple buffer needs.
+enum StatusBody
+{
+  SB_STATE,
+  SB_LIGHTS,
+  SB_TIMERS,
+  SB_DISTANCE,
+  SB_MODE,
+  SB_ROAD,
+  SB_TELEMETRY,
+  SB_COUNT
+};
+
+const size_t STATUS_BODY_MAX = 256; // /timers with a booking is the longest
+const size_t RESV_BODY_MAX = 96 + RESV_MAX * 80; // an entry is at most 64
+// Worst-case entries: a peer is 108 bytes, a track 142, the rest 149
+const size_t CORR_BODY_MAX = 160 + CORR_PEERS * 112 + CORR_TRACKS * 144;
+
+struct StatusSnapshot
+{
+  uint32_t version;
+  bool timersRunning; // a running countdown changes /timers every tick
+  char etag[16];
+  char body[SB_COUNT][STATUS_BODY_MAX];
+  char reservations[RESV_BODY_MAX]; // GET /reservations, the whole table
+  char corridor[CORR_BODY_MAX];     // GET /corridor
+};
+
+const uint8_t STATUS_FRESH = 4; // in statusLatest: not yet picked up by the reader
+StatusSnapshot statusBuf[3];
+std::atomic<uint8_t> statusLatest(0);
+uint8_t statusBack = 1;  // control loop's slot
+uint8_t statusFront = 2; // reader's slot
+
+// snprintf onto the end of buf. len never passes the terminator, so after a
+// truncated write the next one is cut short too instead of running past cap.
+void appendf(char *buf, size_t cap, size_t &len, const char *fmt, ...)
+{
+  if (len + 1 >= cap)
+    return;
+  va_list ap;
+  va_start(ap, fmt);
+  int n = vsnprintf(buf + len, cap - len, fmt, ap);
+  va_end(ap);
+  if (n > 0)
+    len += (size_t)n < cap - len ? (size_t)n : cap - len - 1;
+}
+
+// Lamp as the UI sees it: 0 / 1 steady, or [period_ms,on_ms] flashing
+void formatLamp(char (&out)[14], const LampPattern &p)
+{
+  if (p.flashing())
+    snprintf(out, sizeof(out), "[%u,%u]", p.periodMs, p.onMs);
+  else
+    snprintf(out, sizeof(out), "%d", p.lit());
+}
+
+void publishStatus(unsigned long now)
+{
+  StatusSnapshot &s = statusBuf[statusBack];
+  uint32_t v = stateVersion.load(std::memory_order_acquire);
+  long roadRemainMs, boatRemainMs;
+  computeTimers(now, roadRemainMs, boatRemainMs);
+
+  s.version = v;
+  s.timersRunning = roadRemainMs > 0 || boatRemainMs > 0 || resvCount > 0;
+  snprintf(s.etag, sizeof(s.etag), "\"%u\"", (unsigned)v);
+  snprintf(s.body[SB_STATE], STATUS_BODY_MAX, "{\"state\":\"%s\",\"version\":%u}",
+           stateString(currentState), (unsigned)v);
+  char lamp[6][14];
+  for (int i = 0; i < 6; i++)
+    formatLamp(lamp[i], (i < 3 ? roadLamps : boatLamps)[i % 3].pattern());
+  snprintf(s.body[SB_LIGHTS], STATUS_BODY_MAX,
+           "{\"road\":{\"red\":%s,\"yellow\":%s,\"green\":%s},"
+           "\"boat\":{\"red\":%s,\"yellow\":%s,\"green\":%s},\"version\":%u}",
+           lamp[0], lamp[1], lamp[2], lamp[3], lamp[4], lamp[5], (unsigned)v);
+  // Countdowns to the next (merged) opening: warn_in_ms is when the road
+  // warning starts, negative once it has
+  char next[112] = "null";
+  unsigned long openAt, until;
+  if (nextWindow(openAt, until))
+    snprintf(next, sizeof(next),
+             "{\"id\":%u,\"open_in_ms\":%ld,\"warn_in_ms\":%ld,\"until_in_ms\":%ld}",
+             (unsigned)resv[0].id, (long)(openAt - now), (long)(openAt - resvLeadMs() - now), (long)(until - now));
+  snprintf(s.body[SB_TIMERS], STATUS_BODY_MAX,
+           "{\"road\":{\"remaining_ms\":%ld},\"boat\":{\"remaining_ms\":%ld},"
+           "\"next\":%s,\"reservations\":%d,\"version\":%u}",
+           roadRemainMs, boatRemainMs, next, resvCount, (unsigned)v);
+  snprintf(s.body[SB_DISTANCE], STATUS_BODY_MAX, "{\"A\":%.1f,\"B\":%.1f}",
+           (double)distanceA.load(), (double)distanceB.load());
+  snprintf(s.body[SB_MODE], STATUS_BODY_MAX, "{\"value\":\"%s\"}", manualMode ? "manual" : "auto");
+  snprintf(s.body[SB_ROAD], STATUS_BODY_MAX,
+           "{\"present\":%d,\"vehicles\":%u,\"occupancy\":%.3f,\"lane_present\":[%d,%d],\"lane_count\":[%u,%u]}",
+           roadSensor.present(), (unsigned)roadSensor.vehicles(), (double)roadSensor.occupancy(),
+           roadSensor.lane(0).present.load(), roadSensor.lane(1).present.load(),
+           (unsigned)roadSensor.lane(0).count.load(), (unsigned)roadSensor.lane(1).count.load());
+  snprintf(s.body[SB_TELEMETRY], STATUS_BODY_MAX,
+           "{\"enabled\":%d,\"device\":%u,\"records\":%u,\"sent\":%u,\"acked\":%u,\"dropped\":%u,"
+           "\"pending\":%d,\"bytes\":%u}",
+           telemetry.enabled(), (unsigned)deviceId(), (unsigned)telemetry.records(), (unsigned)telemetry.batchesSent(),
+           (unsigned)telemetry.batchesAcked(), (unsigned)telemetry.batchesDropped(), telemetry.pending(),
+           (unsigned)telemetry.bytesSent());
+  size_t n = 0;
+  appendf(s.reservations, RESV_BODY_MAX, n, "{\"lead_ms\":%lu,\"dropped\":%u,\"list\":[", resvLeadMs(),
+          (unsigned)resvDropped.load());
+  for (int i = 0; i < resvCount; i++)
+    appendf(s.reservations, RESV_BODY_MAX, n, "%s{\"id\":%u,\"open_in_ms\":%ld,\"hold_ms\":%lu}", i ? "," : "",
+            (unsigned)resv[i].id, (long)(resv[i].openAtMs - now), resv[i].holdMs);
+  appendf(s.reservations, RESV_BODY_MAX, n, "]}");
+
+  n = 0;
+  appendf(s.corridor, CORR_BODY_MAX, n,
+          "{\"id\":%u,\"pos_cm\":%ld,\"sent\":%u,\"received\":%u,\"lost\":%u,\"stale\":%u,\"bad\":%u,"
+          "\"peers\":[",
+          (unsigned)CORRIDOR_ID, (long)CORRIDOR_POS_CM, (unsigned)corridor.sent(), (unsigned)corridor.received(),
+          (unsigned)corridor.lost(), (unsigned)corridor.stale(), (unsigned)corridor.bad());
+  for (int i = 0; i < corridor.peerCount(); i++)
+  {
+    const CorridorPeer &p = corridor.peer(i);
+    appendf(s.corridor, CORR_BODY_MAX, n,
+            "%s{\"id\":%u,\"pos_cm\":%ld,\"state\":\"%s\",\"deck\":%u,\"heard_ms\":%lu,\"lost\":%u}",
+            i ? "," : "", p.id, (long)p.posCm, stateString((MotorState)p.state), p.deck, now - p.heardMs,
+            (unsigned)p.lost);
+  }
+  appendf(s.corridor, CORR_BODY_MAX, n, "],\"tracks\":[");
+  for (int i = 0; i < corridor.trackCount(); i++)
+  {
+    const CorridorTrack &t = corridor.track(i);
+    appendf(s.corridor, CORR_BODY_MAX, n,
+            "%s{\"id\":%u,\"rev\":%u,\"dir\":%d,\"seen_by\":%u,\"seen_at_cm\":%ld,\"seen_ms\":%lu,"
+            "\"speed_cms\":%u,\"eta_ms\":%ld,\"passed\":%d}",
+            i ? "," : "", t.id, t.rev, t.dir, t.seenBy, (long)t.seenAtCm, now - t.seenMs, t.speedCms,
+            t.etaMs(CORRIDOR_POS_CM, now), t.passed);
+  }
+  snprintf(s.corridor + n, CORR_BODY_MAX - n, "]}");
+
+  statusBack = statusLatest.exchange(statusBack | STATUS_FRESH, std::memory_order_acq_rel) & 3;
+}
+
+// Reader side: newest complete snapshot, stable until the next call
+const StatusSnapshot &statusSnapshot()
+{
+  if (statusLatest.load(std::memory_order_relaxed) & STATUS_FRESH)
+    statusFront = statusLatest.exchange(statusFront, std::memory_order_acq_rel) & 3;
+  return statusBuf[statusFront];
+}
+
+void sendStatus(AsyncWebServerRequest *req, StatusBody body)
+{
+  req->send(200, "application/json", statusSnapshot().body[body]);
+}
+
+// Counts a response for as long as it lives, however it ends (sent or dropped)
+struct ResponseSlot
+{
+  std::atomic<int> &count;
+  explicit ResponseSlot(std::atomic<int> &c) : count(c) { count++; }
+  ~ResponseSlot() { count--; }
+};
+
+// Conditional GET / long-poll for the status routes.
+//   If-None-Match: "<version>"  or  ?since=<version>
+// If the client is already up to date it gets 304 straight away, or with
+// ?since= and ?wait=<ms> the request is held until the version moves. A held
+// request is committed to 200 when it is parked (the status line and headers
+// go out before the new version is known), so it carries no ETag: the
+// version is only in the body, as "version", which is what ?since= takes.
+// If-None-Match clients would lose their tag that way, so they are never
+// held; to long-poll, use ?since=. On timeout a held request carries the
+// unchanged body. Completion is picked up when async_tcp polls the
+// connection.
+void sendVersioned(AsyncWebServerRequest *req, StatusBody body)
+{
+  const StatusSnapshot &snap = statusSnapshot();
+  uint32_t version = snap.version;
+  bool conditional = false, holdable = false;
+  uint32_t since = 0;
+  if (req->hasParam("since"))
+  {
+    conditional = holdable = true;
+    since = (uint32_t)req->getParam("since")->value().toInt();
+  }
+  else if (req->hasHeader("If-None-Match"))
+  {
+    String tag = req->getHeader("If-None-Match")->value();
+    int q = tag.indexOf('"');
+    conditional = true;
+    since = (uint32_t)tag.substring(q + 1).toInt();
+  }
+
+  if (!conditional || since != version || (body == SB_TIMERS && snap.timersRunning))
+  {
+    AsyncWebServerResponse *res = req->beginResponse(200, "application/json", snap.body[body]);
+    res->addHeader("ETag", snap.etag);
+    res->addHeader("Cache-Control", "no-cache");
+    req->send(res);
+    return;
+  }
+
+  unsigned long wait = 0;
+  if (holdable && req->hasParam("wait"))
+    wait = (unsigned long)req->getParam("wait")->value().toInt();
+  if (wait == 0 || heldPolls.load() >= MAX_HELD_POLLS)
+  {
+    req->send(304);
+    return;
+  }
+  if (wait > LONG_POLL_MAX_MS)
+    wait = LONG_POLL_MAX_MS;
+
+  unsigned long deadline = millis() + wait;
+  std::shared_ptr<ResponseSlot> slot = std::make_shared<ResponseSlot>(heldPolls);
+  // The body is copied out when the wait ends, so every chunk comes from the
+  // same snapshot however small async_tcp makes them
+  std::shared_ptr<std::vector<uint8_t>> out = std::make_shared<std::vector<uint8_t>>();
+  AsyncWebServerResponse *res = req->beginChunkedResponse("application/json",
+    [body, since, deadline, slot, out](uint8_t *buf, size_t maxLen, size_t index) -> size_t
+    {
+      if (index == 0)
       {
-        boatClearTime = 0;
+        const StatusSnapshot &snap = statusSnapshot();
+        if (snap.version == since && (long)(millis() - deadline) < 0)
+          return RESPONSE_TRY_AGAIN;
+        const char *text = snap.body[body];
+        out->assign(text, text + strnlen(text, STATUS_BODY_MAX));
       }
-      break;
+      size_t n = index < out->size() ? out->size() - index : 0;
+      if (n > maxLen)
+        n = maxLen;
+      memcpy(buf, out->data() + index, n);
+      return n;
+    });
+  res->addHeader("Cache-Control", "no-cache");
+  req->send(res);
+}
+
+void recordTick(unsigned long now)
+{
+  static unsigned long lastTick = 0;
+  if (lastTick != 0)
+  {
+    uint32_t dt = (uint32_t)(now - lastTick);
+    int b = dt / TICK_HIST_WIDTH_MS;
+    if (b >= TICK_HIST_BUCKETS)
+      b = TICK_HIST_BUCKETS - 1;
+    tickHist[b].fetch_add(1, std::memory_order_relaxed);
+    tickIntervalSumMs.fetch_add(dt, std::memory_order_relaxed);
+    if (dt > tickIntervalMaxMs.load(std::memory_order_relaxed))
+      tickIntervalMaxMs.store(dt, std::memory_order_relaxed);
+    tickCount.fetch_add(1, std::memory_order_relaxed);
+  }
+  lastTick = now;
+}
+
+String metricsJson()
+{
+  String json = "{\"tick\":{\"count\":" + String(tickCount.load()) +
+                ",\"sum_ms\":" + String(tickIntervalSumMs.load()) +
+                ",\"max_ms\":" + String(tickIntervalMaxMs.load()) +
+                ",\"bucket_ms\":" + String(TICK_HIST_WIDTH_MS) + ",\"hist\":[";
+  for (int i = 0; i < TICK_HIST_BUCKETS; i++)
+  {
+    if (i)
+      json += ",";
+    json += String(tickHist[i].load(std::memory_order_relaxed));
+  }
+  json += "]},\"boot\":{\"first_tick_ms\":" + String(firstTickMs) +
+          ",\"link_up_ms\":" + String(linkUpMs) + "}";
+  json += ",\"estop\":{\"latched\":" + String(estopLatched.load()) +
+          ",\"trips\":" + String(estopTrips.load()) +
+          ",\"last_us\":" + String(cyclesToUs(estopLastCycles.load())) +
+          ",\"max_us\":" + String(cyclesToUs(estopMaxCycles.load())) +
+          ",\"bound_us\":" + String(ESTOP_BOUND_US) + "}";
+  json += ",\"road\":{\"frames\":" + String(roadSensor.frames()) +
+          ",\"overruns\":" + String(roadSensor.overruns()) + ",\"lanes\":[";
+  for (int i = 0; i < ROAD_LANES; i++)
+  {
+    const RoadLane &lane = roadSensor.lane(i);
+    json += String(i ? "," : "") + "{\"level\":" + String(lane.level.load()) +
+            ",\"baseline\":" + String(lane.baseline.load()) +
+            ",\"occupied_ms\":" + String(lane.occupiedFrames.load() * (1000 / ROAD_FRAME_HZ)) + "}";
+  }
+  json += "]}";
+  json += ",\"heap\":" + String(ESP.getFreeHeap()) + "}";
+  return json;
+}
+
+// Changes when any lamp's pattern does, not on each flash
+uint32_t lampSignature()
+{
+  uint32_t h = 2166136261u; // FNV-1a
+  for (int i = 0; i < 6; i++)
+  {
+    const LampPattern &p = (i < 3 ? roadLamps : boatLamps)[i % 3].pattern();
+    h = (h ^ p.periodMs) * 16777619u;
+    h = (h ^ p.onMs) * 16777619u;
+  }
+  return h;
+}
+
+// Bump stateVersion if anything a status route reports has changed
+void publishStateVersion()
+{
+  static uint32_t lastSig = 0, lastLamps = 0, lastResv = 0;
+  static unsigned long lastClear = 0, lastYellow = 0;
+  static uint16_t lastTarget = DECK_CLOSED;
+  static int lastDir = 0;
+  uint32_t sig = (uint32_t)currentState | (manualMode ? 1u << 8 : 0);
+  uint32_t lamps = lampSignature();
+  if (sig != lastSig || lamps != lastLamps || boatClearTime != lastClear ||
+      yellowStartTime != lastYellow || deck.target() != lastTarget || deck.direction() != lastDir ||
+      resvGen != lastResv)
+  {
+    lastResv = resvGen;
+    lastSig = sig;
+    lastLamps = lamps;
+    lastClear = boatClearTime;
+    lastYellow = yellowStartTime;
+    lastTarget = deck.target();
+    lastDir = deck.direction();
+    stateVersion.fetch_add(1, std::memory_order_release);
+  }
+}
+
+// Static file straight from flash, still gzipped. Every browser we target
+// sends Accept-Encoding: gzip. ETags are content hashes, so a reload after a
+// firmware update fetches the new file and otherwise gets a 304.
+void sendAsset(AsyncWebServerRequest *req, const WebAsset &asset)
+{
+  if (req->hasHeader("If-None-Match") && req->getHeader("If-None-Match")->value() == asset.etag)
+  {
+    req->send(304);
+    return;
+  }
+  AsyncWebServerResponse *res = req->beginResponse_P(200, asset.mime, asset.gz, asset.len);
+  res->addHeader("Content-Encoding", "gzip");
+  res->addHeader("ETag", asset.etag);
+  res->addHeader("Cache-Control", "no-cache");
+  req->send(res);
+}
+
+// Registers a route with HTTP begin/end trace events around its handler
+void onRoute(const char *uri, WebRequestMethodComposite method, ArRequestHandlerFunction fn)
+{
+  uint8_t id = 0xff;
+  if (traceRouteCount < TRACE_MAX_ROUTES)
+  {
+    id = traceRouteCount++;
+    traceRoutes[id] = uri;
+  }
+  server.on(uri, method, [id, fn](AsyncWebServerRequest *req)
+            {
+    trace(TR_HTTP_BEGIN, id);
+    fn(req);
+    trace(TR_HTTP_END, id); });
+}
+
+// Trace dump: "BTR2", u32 timestamp ticks per us (1), u8 cores, u8 routes,
+// u8 states, u8 0, u32 records per core; per core: u32 count + that many
+// 8-byte records, oldest first; then the route and state names,
+// NUL-terminated.
+std::shared_ptr<std::vector<uint8_t>> buildTraceDump()
+{
+  std::shared_ptr<std::vector<uint8_t>> out = std::make_shared<std::vector<uint8_t>>();
+  std::vector<uint8_t> &d = *out;
+  auto u32 = [&d](uint32_t v)
+  {
+    for (int k = 0; k < 4; k++)
+      d.push_back((uint8_t)(v >> (8 * k)));
+  };
+  const int stateCount = FAULT + 1;
+
+  tracePaused.store(true);
+  d.reserve(16 + TRACE_CORES * (4 + TRACE_LEN * sizeof(TraceRecord)) + 512);
+  d.insert(d.end(), {'B', 'T', 'R', '2'});
+  u32(1);
+  d.insert(d.end(), {(uint8_t)TRACE_CORES, traceRouteCount, (uint8_t)stateCount, 0});
+  u32(TRACE_LEN);
+  for (int c = 0; c < TRACE_CORES; c++)
+  {
+    uint32_t head = traceHead[c].load();
+    uint32_t count = head < TRACE_LEN ? head : TRACE_LEN;
+    u32(count);
+    for (uint32_t i = head - count; i != head; i++)
+    {
+      const uint8_t *r = (const uint8_t *)&traceRing[c][i & (TRACE_LEN - 1)];
+      d.insert(d.end(), r, r + sizeof(TraceRecord));
+    }
+  }
+  tracePaused.store(false);
+
+  for (int i = 0; i < traceRouteCount; i++)
+    d.insert(d.end(), traceRoutes[i], traceRoutes[i] + strlen(traceRoutes[i]) + 1);
+  for (int i = 0; i < stateCount; i++)
+  {
+    const char *n = stateString((MotorState)i);
+    d.insert(d.end(), n, n + strlen(n) + 1);
+  }
+  return out;
+}
+
+// HTTP Routes 
+void setupRoutes()
+{
+  DefaultHeaders::Instance().addHeader("Access-Control-Allow-Origin", "*");
+
+  // Mode GET
+  onRoute("/mode", HTTP_GET, [](AsyncWebServerRequest *req)
+          { sendStatus(req, SB_MODE); });
+
+  // Mode POST
+  onRoute("/mode", HTTP_POST, [](AsyncWebServerRequest *req)
+          {
+    if (!req->hasParam("value")) {
+      req->send(400, "text/plain", "missing value");
+      return;
+    }
+    String v = req->getParam("value")->value();
+    v.toLowerCase();
+    if (v == "manual")      sendCommand(req, CMD_MODE_MANUAL, "manual");
+    else if (v == "auto")   sendCommand(req, CMD_MODE_AUTO, "auto");
+    else                    req->send(400, "text/plain", "invalid value"); });
+
+  // Manual open/close (only if manualMode)
+  onRoute("/led/on", HTTP_ANY, [](AsyncWebServerRequest *req) { // OPEN
+    if (!manualMode)
+    {
+      req->send(403, "text/plain", "Manual mode required");
+      return;
+    }
+    sendCommand(req, CMD_OPEN, "OPENING");
+  });
+
+  onRoute("/led/off", HTTP_ANY, [](AsyncWebServerRequest *req) { // CLOSE
+    if (!manualMode)
+    {
+      req->send(403, "text/plain", "Manual mode required");
+      return;
+    }
+    sendCommand(req, CMD_CLOSE, "CLOSING");
+  });
+
+  // Emergency stop: the drive is cut before this handler returns. It latches
+  // FAULT, so POST only: a prefetch or a crawler must not lock the bridge.
+  onRoute("/stop", HTTP_POST, [](AsyncWebServerRequest *req)
+          {
+    uint32_t entry = isrCycles();
+    estopTrip(ESTOP_API, entry);
+    String json = String("{\"status\":\"STOPPED\",\"cut_us\":") + String(cyclesToUs(estopLastCycles.load())) + "}";
+    req->send(200, "application/json", json); });
+
+  // The loop checks the button again when it applies the reset; this tells
+  // the operator why nothing happened
+  onRoute("/estop/reset", HTTP_POST, [](AsyncWebServerRequest *req)
+          {
+    if (digitalRead(estopPin) == LOW) {
+      req->send(409, "text/plain", "E-stop button still pressed");
+      return;
+    }
+    sendCommand(req, CMD_FAULT_RESET, "RESET"); });
+
+  // Booked openings: ?at=<unix s> or ?in=<s>, optional &hold=<s>. The
+  // control loop enters the booking when it drains the command.
+  onRoute("/reservations/cancel", HTTP_POST, [](AsyncWebServerRequest *req)
+          {
+    if (!req->hasParam("id")) {
+      req->send(400, "text/plain", "missing id");
+      return;
+    }
+    uint32_t args[CMD_ARGS] = {(uint32_t)req->getParam("id")->value().toInt()};
+    sendCommand(req, CMD_CANCEL, "cancelling", args); });
+
+  onRoute("/reservations", HTTP_GET, [](AsyncWebServerRequest *req)
+          { req->send(200, "application/json", statusSnapshot().reservations); });
 
-    case BRIDGE_CLOSING:
-      // Road RED; Boat RED + YELLOW flashing 3s then motor down
-      applyRoad(true, false, false);
-      applyBoat(true, false, false);
-      flashBoatYellow();
-      if (now - yellowStartTime >= BOAT_WARNING_MS)
+  onRoute("/reservations", HTTP_POST, [](AsyncWebServerRequest *req)
+          {
+    unsigned long now = millis();
+    // Range-checked in seconds: a month ahead in ms is past a 32-bit long
+    double inS;
+    if (req->hasParam("in")) {
+      inS = req->getParam("in")->value().toFloat();
+    } else if (req->hasParam("at")) {
+      time_t unixNow = time(nullptr);
+      if (unixNow < 1600000000) {
+        req->send(503, "text/plain", "clock not set, use in=");
+        return;
+      }
+      inS = strtod(req->getParam("at")->value().c_str(), nullptr) - (double)unixNow;
+    } else {
+      req->send(400, "text/plain", "missing at or in");
+      return;
+    }
+    double holdS = req->hasParam("hold") ? req->getParam("hold")->value().toFloat() : RESV_HOLD_DEFAULT_MS / 1000.0;
+    if (!(inS + holdS > 0) || !(inS <= RESV_HORIZON_MS / 1000.0) || !(holdS * 1000 >= 1) ||
+        !(holdS <= RESV_HOLD_MAX_MS / 1000.0)) {
+      req->send(400, "text/plain", "time out of range");
+      return;
+    }
+    long inMs = (long)(inS * 1000);
+    unsigned long holdMs = (unsigned long)(holdS * 1000);
+    uint32_t id = resvNextId.fetch_add(1);
+    uint32_t args[CMD_ARGS] = {id, (uint32_t)(now + inMs), (uint32_t)holdMs};
+    // Too close to warn the road in full: opens as soon as it can
+    bool late = inMs < (long)resvLeadMs();
+    sendCommand(req, CMD_RESERVE, "booked", args,
+                String(",\"id\":") + String(id) + ",\"late\":" + (late ? "true" : "false")); });
+
+  // Telemetry uplink: ?host=<IPv4>&port=<udp>[&batch_ms=], port=0 turns it off
+  onRoute("/telemetry", HTTP_GET, [](AsyncWebServerRequest *req)
+          { sendStatus(req, SB_TELEMETRY); });
+
+  onRoute("/telemetry", HTTP_POST, [](AsyncWebServerRequest *req)
+          {
+    unsigned a, b, c, d;
+    if (!req->hasParam("host") || !req->hasParam("port") ||
+        sscanf(req->getParam("host")->value().c_str(), "%u.%u.%u.%u", &a, &b, &c, &d) != 4 ||
+        (a | b | c | d) > 255) {
+      req->send(400, "text/plain", "need host=<IPv4> and port");
+      return;
+    }
+    long port = req->getParam("port")->value().toInt();
+    long batchMs = req->hasParam("batch_ms") ? req->getParam("batch_ms")->value().toInt() : 0;
+    if (port < 0 || port > 65535 || batchMs < 0) {
+      req->send(400, "text/plain", "invalid port or batch_ms");
+      return;
+    }
+    uint32_t args[CMD_ARGS] = {a << 24 | b << 16 | c << 8 | d, (uint32_t)port, (uint32_t)batchMs};
+    sendCommand(req, CMD_TELEMETRY, port ? "uplink" : "off", args); });
+
+  // Neighbouring bridges and the boats they have seen
+  onRoute("/corridor", HTTP_GET, [](AsyncWebServerRequest *req)
+          { req->send(200, "application/json", statusSnapshot().corridor); });
+
+  // Command completion: done once the control loop has applied seq
+  onRoute("/cmd", HTTP_GET, [](AsyncWebServerRequest *req)
+          {
+    if (!req->hasParam("seq")) {
+      req->send(400, "text/plain", "missing seq");
+      return;
+    }
+    uint32_t seq = (uint32_t)req->getParam("seq")->value().toInt();
+    uint32_t applied = cmdAppliedSeq.load(std::memory_order_acquire);
+    String json = String("{\"seq\":") + String(seq) +
+                  ",\"applied\":" + String(applied) +
+                  ",\"done\":" + ((int32_t)(applied - seq) >= 0 ? "true" : "false") + "}";
+    req->send(200, "application/json", json); });
+
+  // Live measurements
+  onRoute("/distance", HTTP_GET, [](AsyncWebServerRequest *req)
+          { sendStatus(req, SB_DISTANCE); });
+
+  onRoute("/road", HTTP_GET, [](AsyncWebServerRequest *req)
+          { sendStatus(req, SB_ROAD); });
+
+  // Raw sample capture
+  onRoute("/capture/start", HTTP_POST, [](AsyncWebServerRequest *req)
+          {
+    if (captureReaders.load() > 0) {
+      req->send(409, "text/plain", "download in progress");
+      return;
+    }
+    sendCommand(req, CMD_CAPTURE_START, "capturing"); });
+
+  onRoute("/capture/stop", HTTP_POST, [](AsyncWebServerRequest *req)
+          { sendCommand(req, CMD_CAPTURE_STOP, "stopped"); });
+
+  onRoute("/capture/status", HTTP_GET, [](AsyncWebServerRequest *req)
+          {
+    String json = String("{\"capturing\":") + (capturing ? "true" : "false") +
+                  ",\"records\":" + String(captureRecords.load()) +
+                  ",\"bytes\":" + String(captureLen.load()) +
+                  ",\"capacity\":" + String((uint32_t)CAPTURE_BYTES) +
+                  ",\"dropped\":" + String(captureDropped.load()) + "}";
+    req->send(200, "application/json", json); });
+
+  onRoute("/capture/data", HTTP_GET, [](AsyncWebServerRequest *req)
+          {
+    // Reader slot first, then the check: see startCapture()
+    std::shared_ptr<ResponseSlot> reader = std::make_shared<ResponseSlot>(captureReaders);
+    if (capturing.load()) {
+      req->send(409, "text/plain", "stop the capture first");
+      return;
+    }
+    uint8_t header[CAPTURE_HEADER_BYTES] = {'B', 'R', 'C', '1'};
+    uint32_t fields[3] = {captureStartUs, captureRecords.load(), captureDropped.load()};
+    for (int f = 0; f < 3; f++)
+      for (int k = 0; k < 4; k++)
+        header[4 + f * 4 + k] = (uint8_t)(fields[f] >> (8 * k));
+    uint32_t total = CAPTURE_HEADER_BYTES + captureLen.load(std::memory_order_acquire);
+    std::shared_ptr<std::vector<uint8_t>> head =
+        std::make_shared<std::vector<uint8_t>>(header, header + CAPTURE_HEADER_BYTES);
+    AsyncWebServerResponse *res = req->beginChunkedResponse("application/octet-stream",
+      [total, head, reader](uint8_t *buf, size_t maxLen, size_t index) -> size_t
       {
-        rotateBackward();
-        rotationStartTime = now;
-        while (millis() - rotationStartTime < ROTATION_DURATION)
+        size_t n = 0;
+        while (index + n < total && n < maxLen)
         {
-          flashBoatYellow(); // keep flashing while moving
-          delay(10);
+          size_t at = index + n;
+          buf[n++] = at < CAPTURE_HEADER_BYTES ? (*head)[at] : captureBuf[at - CAPTURE_HEADER_BYTES];
         }
-        stopMotor();
-        uiBoatYellow = false;
-        digitalWrite(yellowLEDPin_B, LOW);
-        currentState = IDLE;
-        Serial.println("Bridge closed -> IDLE STATE");
+        return n;
+      });
+    res->addHeader("Content-Disposition", "attachment; filename=\"capture.brc\"");
+    req->send(res); });
+
+  // Traffic light mirror for UI
+  onRoute("/lights", HTTP_GET, [](AsyncWebServerRequest *req)
+          { sendVersioned(req, SB_LIGHTS); });
+
+  // Bridge state
+  onRoute("/state", HTTP_GET, [](AsyncWebServerRequest *req)
+          { sendVersioned(req, SB_STATE); });
+
+  // Timers endpoint: remaining time for road + boat phases
+  onRoute("/timers", HTTP_GET, [](AsyncWebServerRequest *req)
+          { sendVersioned(req, SB_TIMERS); });
+
+  // Control-loop timing for load tests
+  onRoute("/metrics", HTTP_GET, [](AsyncWebServerRequest *req)
+          { req->send(200, "application/json", metricsJson()); });
+
+  // Binary event trace (tools/trace2chrome.cpp)
+  onRoute("/trace", HTTP_GET, [](AsyncWebServerRequest *req)
+          {
+    std::shared_ptr<std::vector<uint8_t>> dump = buildTraceDump();
+    AsyncWebServerResponse *res = req->beginChunkedResponse("application/octet-stream",
+      [dump](uint8_t *buf, size_t maxLen, size_t index) -> size_t
+      {
+        size_t n = index < dump->size() ? dump->size() - index : 0;
+        if (n > maxLen)
+          n = maxLen;
+        memcpy(buf, dump->data() + index, n);
+        return n;
+      });
+    res->addHeader("Content-Disposition", "attachment; filename=\"trace.btr\"");
+    req->send(res); });
+
+  // Serve UI
+  // Dashboard, compiled in from data/ (tools/embed_assets.py)
+  for (size_t i = 0; i < WEB_ASSET_COUNT; i++)
+  {
+    const WebAsset *asset = &WEB_ASSETS[i];
+    onRoute(asset->path, HTTP_GET, [asset](AsyncWebServerRequest *req)
+            { sendAsset(req, *asset); });
+    if (strcmp(asset->path, "/index.html") == 0)
+      onRoute("/", HTTP_GET, [asset](AsyncWebServerRequest *req)
+              { sendAsset(req, *asset); });
+  }
+
+  server.onNotFound([](AsyncWebServerRequest *req)
+                    {
+    if (req->method() == HTTP_OPTIONS) req->send(200);
+    else req->send(404, "text/plain", "Not found"); });
+}
+
+// Control loop only; costs nothing while the uplink is off
+void serviceTelemetry(unsigned long now)
+{
+  if (!telemetry.enabled())
+    return;
+  static unsigned long lastTick = 0, lastSummary = 0, lastMetrics = 0;
+  static uint32_t tickMaxMs = 0;
+  if (lastTick && now - lastTick > tickMaxMs)
+    tickMaxMs = (uint32_t)(now - lastTick);
+  lastTick = now;
+
+  if (now - lastSummary >= TEL_SUMMARY_MS)
+  {
+    lastSummary = now;
+    DistanceSummary &d = telDistance;
+    if (d.samples)
+    {
+      int32_t f[7] = {d.samples, d.min[0], (int32_t)(d.sum[0] / d.samples), d.max[0],
+                      d.min[1], (int32_t)(d.sum[1] / d.samples), d.max[1]};
+      telemetry.record(TEL_DISTANCE, f, now);
+    }
+    d = {};
+    int32_t road[3] = {(int32_t)roadSensor.vehicles(), (int32_t)(roadSensor.occupancy() * 1000),
+                       roadSensor.present()};
+    telemetry.record(TEL_ROAD, road, now);
+  }
+  if (now - lastMetrics >= TEL_METRICS_MS)
+  {
+    lastMetrics = now;
+    int32_t m[5] = {(int32_t)tickCount.load(), (int32_t)tickMaxMs, (int32_t)ESP.getFreeHeap(),
+                    (int32_t)estopTrips.load(), (int32_t)cmdAppliedSeq.load()};
+    tickMaxMs = 0;
+    telemetry.record(TEL_METRICS, m, now);
+  }
+  telemetry.service(now, linkState == LINK_UP);
+}
+
+// Warm restart
+// A software restart, brownout or watchdog reset would otherwise come back
+// in IDLE with the road green, whatever the deck was doing. Every tick the
+// loop checkpoints what it needs to carry on into RTC memory, which keeps
+// its contents through any reset but a power cycle. Two slots are written
+// in turn, each with a sequence number and a checksum, so a reset during a
+// write leaves the other slot good. setup() resumes from the newest good
+// slot. Phase times are kept as ages, since millis() restarts at 0; the
+// reset itself counts as no time, so a warning only ever runs longer.
+// A reset with the drive on lands somewhere in the tick after the last
+// checkpoint, so the deck estimate comes back with up to a tick of drive
+// time as slack; the next move to an end drives on against the end stop to
+// take it out (actuator.h). Bookings, telemetry and corridor tracks are not
+// kept.
+const uint32_t CHECKPOINT_MAGIC = 0xB51DC4E7;
+BRIDGE_TUNABLE bool WARM_RESTART = true; // host tools compare with a cold start
+
+struct Checkpoint
+{
+  uint32_t magic;
+  uint32_t seq;
+  uint8_t state;
+  uint8_t manual;
+  uint8_t estop;        // latched e-stop source
+  uint8_t clearing;     // boat clear window running
+  uint16_t deckPos;
+  uint16_t deckTarget;
+  int16_t deckDir;
+  uint16_t deckSlackMs;
+  uint32_t tickMs;      // longest tick so far
+  uint32_t yellowAgeMs; // since yellowStartTime
+  uint32_t clearAgeMs;  // since boatClearTime
+  uint32_t sum;
+};
+RTC_NOINIT_ATTR Checkpoint checkpoints[2];
+uint32_t checkpointSeq = 0;
+unsigned long checkpointMs = 0;     // last save
+unsigned long checkpointTickMs = 0; // longest time between saves
+
+// FNV-1a over everything before the sum, salted with the layout size so a
+// firmware with a different struct never takes an old checkpoint
+uint32_t checkpointSum(const Checkpoint &c)
+{
+  uint32_t h = 2166136261u ^ (uint32_t)sizeof(Checkpoint);
+  const uint8_t *p = (const uint8_t *)&c;
+  for (size_t i = 0; i < offsetof(Checkpoint, sum); i++)
+    h = (h ^ p[i]) * 16777619u;
+  return h;
+}
+
+bool checkpointValid(const Checkpoint &c)
+{
+  return c.magic == CHECKPOINT_MAGIC && c.sum == checkpointSum(c) && c.state <= FAULT &&
+         c.deckPos <= DECK_OPEN && c.deckTarget <= DECK_OPEN && c.tickMs <= ROTATION_DURATION;
+}
+
+// Control loop only, at the end of every tick
+void saveCheckpoint(unsigned long now)
+{
+  Checkpoint &c = checkpoints[++checkpointSeq & 1];
+  c.magic = CHECKPOINT_MAGIC;
+  c.seq = checkpointSeq;
+  c.state = (uint8_t)currentState;
+  c.manual = manualMode;
+  c.estop = estopLatched.load();
+  c.clearing = boatClearTime != 0;
+  if (checkpointMs && now - checkpointMs > checkpointTickMs)
+    checkpointTickMs = now - checkpointMs < ROTATION_DURATION ? now - checkpointMs : ROTATION_DURATION;
+  checkpointMs = now;
+  c.deckPos = deck.position();
+  c.deckTarget = deck.target();
+  c.deckDir = (int16_t)deck.direction();
+  c.deckSlackMs = (uint16_t)deck.slackMs();
+  c.tickMs = checkpointTickMs;
+  c.yellowAgeMs = now - yellowStartTime;
+  c.clearAgeMs = c.clearing ? now - boatClearTime : 0;
+  c.sum = checkpointSum(c); // last: a write cut short fails the check
+}
+
+// setup() only. Picks up where the newest good checkpoint left off; false
+// (and nothing touched) if there is none, as after a power cycle.
+bool restoreCheckpoint(unsigned long now)
+{
+  const Checkpoint *c = nullptr;
+  for (const Checkpoint &k : checkpoints)
+    if (checkpointValid(k) && (!c || (int32_t)(k.seq - c->seq) > 0))
+      c = &k;
+  if (!WARM_RESTART || !c)
+    return false;
+  checkpointSeq = c->seq;
+  MotorState s = (MotorState)c->state;
+  manualMode = c->manual != 0;
+  yellowStartTime = now - c->yellowAgeMs;
+  boatClearTime = c->clearing ? now - c->clearAgeMs : 0;
+  if (boatClearTime == 0 && c->clearing)
+    boatClearTime = 1; // 0 means not counting
+  checkpointTickMs = c->tickMs;
+  deck.restore(c->deckPos, c->deckSlackMs + (c->deckDir ? c->tickMs : 0), now);
+  if (c->estop != ESTOP_NONE)
+  {
+    // A fault stays a fault until someone resets it
+    uint8_t none = ESTOP_NONE;
+    if (estopLatched.compare_exchange_strong(none, c->estop))
+      estopAtMs.store(now);
+    s = FAULT;
+  }
+  else if (c->deckDir != 0)
+    moveDeck(c->deckTarget, now); // finish the move the reset cut short
+
+  // Lights for the resumed state until the first tick sets them as usual
+  if (s == IDLE)
+    setLights(true, false, false, true, false, false);
+  else if (s == BRIDGE_OPEN)
+    setLights(false, true, false, false, false, true);
+  else
+    setLights(false, true, false, true, false, false);
+  setState(s);
+  Serial.print("Warm restart: ");
+  Serial.print(stateString(s));
+  Serial.print(", deck ");
+  Serial.println(c->deckPos);
+  return true;
+}
+
+void setup()
+{
+  Serial.begin(115200);
+  Serial.println("Bridge + Boat Traffic (WiFi + UI mirror)");
+
+  // Pins
+  deck.begin(); // drive pins + LEDC, drive off
+
+  pinMode(estopPin, INPUT_PULLUP);
+  attachInterrupt(digitalPinToInterrupt(estopPin), estopISR, FALLING);
+  if (digitalRead(estopPin) == LOW)
+    estopTrip(ESTOP_BUTTON, isrCycles()); // held at boot
+
+  for (Lamp &lamp : roadLamps)
+    lamp.begin();
+  for (Lamp &lamp : boatLamps)
+    lamp.begin();
+
+  pinMode(trigPin_A, OUTPUT);
+  pinMode(echoPin_A, INPUT);
+  pinMode(trigPin_B, OUTPUT);
+  pinMode(echoPin_B, INPUT);
+
+  pinMode(whiteLEDPin, OUTPUT);
+  digitalWrite(whiteLEDPin, HIGH); // turn on
+  if (!roadSensor.begin())
+    Serial.println("Road sensor ADC failed, road demand not detected");
+
+  // Resume after a reset; otherwise initial: road green, boat red
+  if (!restoreCheckpoint(millis()))
+    setLights(true, false, false, true, false, false);
+
+  initCommandQueue();
+  publishStatus(millis()); // routes always have a snapshot to serve
+
+  // WiFi joins in the background (serviceWiFi), loop() starts right away
+  WiFi.mode(WIFI_STA);
+  WiFi.setAutoReconnect(false);
+}
+
+// AUTO state machine: one step per tick, on the distances just sampled
+void stepStateMachine(unsigned long now)
+{
+  switch (currentState)
+  {
+  case IDLE:
+    // Road GREEN, Boat RED
+    setLights(true, false, false, true, false, false);
+    if (distanceA <= DETECT_CM || distanceB <= DETECT_CM)
+    {
+      yellowStartTime = now;
+      setState(ROAD_WARNING);
+      Serial.println("Boat detected -> ROAD_WARNING START");
+    }
+    else if (reservationDue(now))
+    {
+      yellowStartTime = now;
+      setState(ROAD_WARNING);
+      Serial.println("Reservation due -> ROAD_WARNING START");
+    }
+    break;
+
+  case ROAD_WARNING:
+    // Road YELLOW, Boat RED; held while a vehicle is still over the sensors
+    setLights(false, false, true, true, false, false);
+    if (now - yellowStartTime >= ROAD_WARNING_MS && !roadSensor.present())
+    {
+      yellowStartTime = now;
+      setState(BOAT_WARNING);
+      Serial.println("Road warned -> BOAT_WARNING START");
+    }
+    break;
+
+  case BOAT_WARNING:
+    // Road RED; Boat RED + YELLOW flashing
+    applyRoad(LAMP_ON, LAMP_OFF, LAMP_OFF);
+    applyBoat(LAMP_ON, LAMP_WARN_FLASH, LAMP_OFF);
+    if (now - yellowStartTime >= BOAT_WARNING_MS)
+    {
+      moveDeck(DECK_OPEN, now);
+      setState(BRIDGE_OPENING);
+      Serial.println("Opening bridge");
+    }
+    break;
+
+  case BRIDGE_OPENING:
+    // Both RED; boat yellow flashing while moving
+    applyRoad(LAMP_ON, LAMP_OFF, LAMP_OFF);
+    applyBoat(LAMP_ON, LAMP_WARN_FLASH, LAMP_OFF);
+    if (!deck.moving())
+    {
+      // Road RED, Boat GREEN
+      setLights(false, true, false, false, false, true);
+      setState(BRIDGE_OPEN);
+      Serial.println("Bridge open -> Boat GREEN START");
+    }
+    break;
+
+  case BRIDGE_OPEN:
+    // Road RED, Boat GREEN
+    setLights(false, true, false, false, false, true);
+    // Booked: stay open, the clear window starts when the booking ends
+    if (reservationHolds(now))
+    {
+      boatClearTime = 0;
+    }
+    // If no boat for 6s → close
+    else if (distanceA > CLEAR_CM && distanceB > CLEAR_CM)
+    {
+      if (boatClearTime == 0)
+      {
+        boatClearTime = now;
+        Serial.println("No Boat Detected -> 6s wait before closing");
+      }
+      else if (now - boatClearTime >= CLEAR_WINDOW_MS)
+      {
+        yellowStartTime = now;
+        setState(BRIDGE_CLOSING);
+        boatClearTime = 0;
+        Serial.println("Closing sequence start");
       }
+    }
+    else
+    {
+      boatClearTime = 0;
+    }
+    break;
+
+  case FAULT:
+    // Both RED until POST /estop/reset
+    setLights(false, true, false, true, false, false);
+    break;
+
+  case BRIDGE_CLOSING:
+    // Road RED; Boat RED + YELLOW flashing 3s then motor down
+    applyRoad(LAMP_ON, LAMP_OFF, LAMP_OFF);
+    applyBoat(LAMP_ON, LAMP_WARN_FLASH, LAMP_OFF);
+    if (deck.target() != DECK_CLOSED && deck.position() == DECK_OPEN && reservationHolds(now))
+    {
+      // Booked opening came due during the warning: the deck has not moved
+      setState(BRIDGE_OPEN);
+      Serial.println("Reservation due -> stay open");
+      break;
+    }
+    if (now - yellowStartTime < BOAT_WARNING_MS)
       break;
+    if (deck.target() != DECK_CLOSED)
+    {
+      moveDeck(DECK_CLOSED, now); // keep flashing while moving
+    }
+    else if (!deck.moving())
+    {
+      applyBoat(LAMP_ON, LAMP_OFF, LAMP_OFF); // warning over
+      setState(IDLE);
+      Serial.println("Bridge closed -> IDLE STATE");
     }
+    break;
+  }
+}
+
+void loop() // Automatic Mode (state machine)
+{
+  unsigned long now = millis();
+  trace(TR_TICK_BEGIN);
+  recordTick(now);
+  if (firstTickMs == 0)
+  {
+    firstTickMs = now ? now : 1;
+    Serial.print("First control tick at ");
+    Serial.print(now);
+    Serial.println(now > FIRST_TICK_BUDGET_MS ? " ms (over budget)" : " ms");
+  }
+
+  // E-stop tripped since the last tick: settle the deck estimate at the
+  // moment of the cut and hold everything red. Before the commands, so none
+  // of them acts on a bridge that is already stopped.
+  if (estopLatched.load() != ESTOP_NONE && currentState != FAULT)
+  {
+    stopDeck(estopAtMs.load());
+    setLights(false, true, false, true, false, false);
+    setState(FAULT);
+    Serial.println(estopLatched.load() == ESTOP_BUTTON ? "E-STOP (button)" : "E-STOP (API)");
+  }
+
+  // Apply commands queued by the HTTP handlers
+  drainCommands(now);
+  corridor.poll(now);
+  stageCorridor(now);
+  expireReservations(now);
+
+  // Dead-reckon the deck; stops the drive at the end of travel
+  if (deck.update(now))
+    trace(TR_MOTOR, 0, deck.position());
+
+  // Sample distances
+  static unsigned long tSense = 0;
+  static bool sensed = false;
+  if (!sensed || now - tSense >= 120)
+  {
+    sensed = true;
+    uint32_t tA = micros();
+    long echoA = readEchoUs(trigPin_A, echoPin_A);
+    uint32_t tB = micros();
+    long echoB = readEchoUs(trigPin_B, echoPin_B);
+    distanceA = echoToCm(echoA);
+    distanceB = echoToCm(echoB);
+    captureEcho(0, tA, echoA);
+    captureEcho(1, tB, echoB);
+    if (telemetry.enabled())
+      telemetrySample(distanceA, distanceB);
+    tSense = now;
+
+    // A new boat at our sensors, heading away from the side that saw it.
+    // Re-armed once both sides have been clear for a clear window, so a
+    // boat passing from sensor A to sensor B is one sighting.
+    static bool sightArmed = true;
+    static unsigned long clearSince = 0;
+    bool nearA = distanceA <= DETECT_CM, nearB = distanceB <= DETECT_CM;
+    if (sightArmed && (nearA || nearB))
+    {
+      sightArmed = false;
+      corridor.sighted(nearA ? 1 : -1, now);
+    }
+    if (distanceA > CLEAR_CM && distanceB > CLEAR_CM)
+    {
+      if (clearSince == 0)
+        clearSince = now ? now : 1;
+      else if (now - clearSince >= CLEAR_WINDOW_MS)
+        sightArmed = true;
+    }
+    else
+      clearSince = 0;
+  }
+
+  // AUTO state machine
+  if (!manualMode)
+    stepStateMachine(now);
+  else if (!deck.moving())
+  {
+    // Manual moves end on their own at the end of travel
+    if (currentState == BRIDGE_OPENING)
+      setState(BRIDGE_OPEN);
+    else if (currentState == BRIDGE_CLOSING)
+      setState(IDLE);
   }
 
+  saveCheckpoint(now);
+  corridor.service(now, (uint8_t)currentState, deck.position());
+  serviceTelemetry(now);
+  publishStateVersion();
+  publishStatus(now);
+  serviceWiFi(now);
+  trace(TR_TICK_END);
   delay(50);
 }
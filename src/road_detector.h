@@ -0,0 +1,229 @@
+// Road vehicle detector
+// The light sensors under the white LED are sampled by the ADC in continuous
+// (DMA) mode, so the control loop never calls analogRead(). A background task
+// averages each channel down to 100 frames/s and runs a per-lane detector:
+//   - a slow baseline tracks ambient light and sensor drift, and catches up
+//     quickly with a step too small to be a vehicle;
+//   - a vehicle is an excursion from the baseline, in either direction
+//     (shadow or reflection), with hysteresis and a few frames of debounce;
+//   - counts and occupancy are running totals, O(1) memory whatever the
+//     traffic.
+// Everything the loop and the status routes read is atomic.
+#pragma once
+
+#include <Arduino.h>
+#include <atomic>
+#include <driver/adc.h>
+
+const int ROAD_LANES = 2;
+const uint32_t ROAD_ADC_HZ = 20000;     // conversions/s over both lanes (ESP32 DMA minimum)
+const uint32_t ROAD_FRAME_HZ = 100;     // detector frames/s per lane
+const uint32_t ROAD_DMA_BYTES = 256;    // per DMA interrupt, ~6 ms at ROAD_ADC_HZ
+const int ROAD_ON_DELTA = 300;          // counts from baseline: vehicle arrives
+const int ROAD_OFF_DELTA = 150;         // back within this, or below half the peak: vehicle gone
+const uint8_t ROAD_DEBOUNCE = 3;        // frames an edge must hold
+const int ROAD_BASELINE_SHIFT = 11;     // baseline time constant ~20 s
+const int ROAD_BASELINE_FAST_SHIFT = 6; // ~0.6 s, to absorb a step in ambient light
+const int ROAD_OCCUPANCY_SHIFT = 13;    // occupancy averaged over ~80 s
+const uint32_t ROAD_WARMUP_FRAMES = 50; // learn the baseline before detecting
+const uint32_t ROAD_STUCK_FRAMES = 60 * ROAD_FRAME_HZ; // present this long: re-learn
+
+struct RoadLane
+{
+  // Detector state, touched only by the sampler task
+  int32_t baselineQ8 = 0; // baseline << 8
+  uint8_t pending = 0;    // consecutive frames disagreeing with `present`
+  uint32_t frames = 0;
+  uint32_t presentFrames = 0;
+  int peak = 0; // largest excursion of the vehicle on the sensor, signed
+
+  // Published
+  std::atomic<bool> present{false};
+  std::atomic<uint32_t> count{0};
+  std::atomic<uint32_t> occupiedFrames{0};
+  std::atomic<uint16_t> level{0};
+  std::atomic<uint16_t> baseline{0};
+
+  // One averaged frame; true when a vehicle arrives
+  bool step(uint16_t x)
+  {
+    level.store(x, std::memory_order_relaxed);
+    if (frames++ == 0)
+      baselineQ8 = (int32_t)x << 8;
+    int excursion = (int)x - (baselineQ8 >> 8);
+    int delta = abs(excursion);
+    bool was = present.load(std::memory_order_relaxed);
+    bool arrived = false;
+
+    // Leaving is judged against the vehicle's own peak too, so an ambient
+    // step while it sat on the sensor does not keep the lane occupied
+    if (was && abs(excursion) > abs(peak) && (excursion < 0) == (peak < 0))
+      peak = excursion;
+    int toward = peak < 0 ? -excursion : excursion;
+    bool disagree = was ? toward < std::max(ROAD_OFF_DELTA, abs(peak) / 2) : delta > ROAD_ON_DELTA;
+    pending = disagree ? pending + 1 : 0;
+    if (frames > ROAD_WARMUP_FRAMES && pending >= ROAD_DEBOUNCE)
+    {
+      pending = 0;
+      present.store(!was, std::memory_order_relaxed);
+      if (!was)
+      {
+        count.fetch_add(1, std::memory_order_relaxed);
+        presentFrames = 0;
+        peak = excursion;
+        arrived = true;
+      }
+      was = !was;
+    }
+
+    if (was)
+    {
+      occupiedFrames.fetch_add(1, std::memory_order_relaxed);
+      // Something parked on the sensor, or the light changed for good:
+      // take the new level as the baseline rather than block the road.
+      // Start clean, so an edge half-counted before this is not taken as
+      // one the other way after it.
+      if (++presentFrames >= ROAD_STUCK_FRAMES)
+      {
+        baselineQ8 = (int32_t)x << 8;
+        present.store(false, std::memory_order_relaxed);
+        pending = 0;
+        peak = 0;
+        presentFrames = 0;
+      }
+    }
+    else if (!pending)
+    {
+      // The baseline only moves while the lane is clear and steady
+      int shift = delta > ROAD_OFF_DELTA ? ROAD_BASELINE_FAST_SHIFT : ROAD_BASELINE_SHIFT;
+      baselineQ8 += (((int32_t)x << 8) - baselineQ8) >> shift;
+    }
+    baseline.store((uint16_t)(baselineQ8 >> 8), std::memory_order_relaxed);
+    return arrived;
+  }
+};
+
+class RoadDetector
+{
+public:
+  // ADC1 channels, one per lane
+  RoadDetector(adc1_channel_t a, adc1_channel_t b) : channels_{a, b} {}
+
+  // Starts the DMA conversions and the sampler task (core 0, with WiFi).
+  // False if the ADC driver refused; the road then never reads as occupied.
+  bool begin()
+  {
+    adc_digi_init_config_t init = {};
+    init.max_store_buf_size = 4 * ROAD_DMA_BYTES;
+    init.conv_num_each_intr = ROAD_DMA_BYTES;
+    adc_digi_pattern_config_t pattern[ROAD_LANES] = {};
+    for (int i = 0; i < ROAD_LANES; i++)
+    {
+      init.adc1_chan_mask |= BIT(channels_[i]);
+      pattern[i].atten = ADC_ATTEN_DB_11;
+      pattern[i].channel = channels_[i];
+      pattern[i].unit = 0; // ADC1
+      pattern[i].bit_width = 12;
+    }
+    adc_digi_configuration_t config = {};
+    config.conv_limit_en = true; // required on the ESP32
+    config.conv_limit_num = 250;
+    config.pattern_num = ROAD_LANES;
+    config.adc_pattern = pattern;
+    config.sample_freq_hz = ROAD_ADC_HZ;
+    config.conv_mode = ADC_CONV_SINGLE_UNIT_1;
+    config.format = ADC_DIGI_OUTPUT_FORMAT_TYPE1;
+
+    if (adc_digi_initialize(&init) != ESP_OK || adc_digi_controller_configure(&config) != ESP_OK ||
+        adc_digi_start() != ESP_OK)
+      return false;
+    return xTaskCreatePinnedToCore(task, "road", 3072, this, 1, nullptr, 0) == pdPASS;
+  }
+
+  // A vehicle is over either sensor
+  bool present() const
+  {
+    for (int i = 0; i < ROAD_LANES; i++)
+      if (lanes_[i].present.load(std::memory_order_relaxed))
+        return true;
+    return false;
+  }
+
+  uint32_t vehicles() const
+  {
+    uint32_t n = 0;
+    for (int i = 0; i < ROAD_LANES; i++)
+      n += lanes_[i].count.load(std::memory_order_relaxed);
+    return n;
+  }
+
+  // Fraction of recent time with a vehicle over either sensor
+  float occupancy() const { return occupancyQ16_.load(std::memory_order_relaxed) / 65536.0f; }
+
+  const RoadLane &lane(int i) const { return lanes_[i]; }
+  uint32_t frames() const { return frames_.load(std::memory_order_relaxed); }
+  uint32_t overruns() const { return overruns_.load(std::memory_order_relaxed); }
+
+  // One averaged frame per lane. The sampler task calls this; host tools can
+  // call it directly to exercise the detector without the ADC.
+  void frame(const uint16_t (&levels)[ROAD_LANES])
+  {
+    for (int i = 0; i < ROAD_LANES; i++)
+      lanes_[i].step(levels[i]);
+    int32_t occ = occupancyQ16_.load(std::memory_order_relaxed);
+    occ += (((int32_t)present() << 16) - occ) >> ROAD_OCCUPANCY_SHIFT;
+    occupancyQ16_.store(occ, std::memory_order_relaxed);
+    frames_.fetch_add(1, std::memory_order_relaxed);
+  }
+
+private:
+  static void task(void *arg) { static_cast<RoadDetector *>(arg)->run(); }
+
+  void run()
+  {
+    const uint32_t perFrame = ROAD_ADC_HZ / ROAD_LANES / ROAD_FRAME_HZ;
+    uint8_t buf[ROAD_DMA_BYTES];
+    uint32_t sum[ROAD_LANES] = {}, n[ROAD_LANES] = {};
+    uint16_t levels[ROAD_LANES] = {};
+    uint32_t fresh = 0; // lanes with a new level since the last frame
+    for (;;)
+    {
+      uint32_t len = 0;
+      esp_err_t err = adc_digi_read_bytes(buf, sizeof(buf), &len, ADC_MAX_DELAY);
+      if (err == ESP_ERR_INVALID_STATE)
+      {
+        // Conversions were lost; what we got is good, the partial sums are not
+        overruns_.fetch_add(1, std::memory_order_relaxed);
+        for (int l = 0; l < ROAD_LANES; l++)
+          sum[l] = n[l] = 0;
+      }
+      else if (err != ESP_OK)
+        continue;
+      for (uint32_t i = 0; i + sizeof(adc_digi_output_data_t) <= len; i += sizeof(adc_digi_output_data_t))
+      {
+        adc_digi_output_data_t d;
+        memcpy(&d, buf + i, sizeof(d));
+        int lane = d.type1.channel == channels_[0] ? 0 : (d.type1.channel == channels_[1] ? 1 : -1);
+        if (lane < 0)
+          continue;
+        sum[lane] += d.type1.data;
+        if (++n[lane] < perFrame)
+          continue;
+        levels[lane] = (uint16_t)(sum[lane] / perFrame);
+        sum[lane] = n[lane] = 0;
+        fresh |= 1u << lane;
+        if (fresh == (1u << ROAD_LANES) - 1)
+        {
+          frame(levels);
+          fresh = 0;
+        }
+      }
+    }
+  }
+
+  adc1_channel_t channels_[ROAD_LANES];
+  RoadLane lanes_[ROAD_LANES];
+  std::atomic<int32_t> occupancyQ16_{0};
+  std::atomic<uint32_t> frames_{0};
+  std::atomic<uint32_t> overruns_{0};
+};
@@ -0,0 +1,298 @@
+// Telemetry uplink
+// The controller pushes what it would otherwise be scraped for (state
+// changes, per-second sensor summaries, loop metrics) to a collector as UDP
+// batches. Records pile up in a batch until it is full or old enough, so the
+// radio wakes for one datagram every few tens of seconds instead of once per
+// event. The collector acks each batch; unacked batches stay in a fixed ring
+// and are resent with backoff, and when the ring is full the oldest is
+// dropped and counted, so a dead collector costs bounded memory.
+//
+// Batch datagram, little endian (decoded by tools/telemetry_collector.h):
+//   "BT", u8 version, u8 0, u32 device, u32 batch seq, u32 base ms,
+//   u16 records, u16 0, u32 boot, then per record:
+//     varint((dt_ms << 3) | type)   dt_ms since the previous record (first:
+//                                   since base ms)
+//     TEL_FIELDS[type] x varint(zigzag(value - same field's previous value
+//                                      in this batch))
+// Every batch decodes on its own: deltas restart from 0 in each. Batch seqs
+// start over at 1 on every boot; boot is random per boot, so the collector
+// can tell a restart from old resends. It is drawn when the uplink is
+// configured, over Wi-Fi: the RNG is only truly random with the radio on.
+// Ack datagram: "BA", u8 version, u8 0, u32 device, u32 batch seq.
+#pragma once
+
+#include <Arduino.h>
+#include <WiFiUdp.h>
+
+const uint8_t TEL_VERSION = 2;
+const size_t TEL_BATCH_BYTES = 1200;        // one datagram, well under the MTU
+const size_t TEL_HEADER_BYTES = 24;
+const size_t TEL_ACK_BYTES = 12;
+const int TEL_RING = 8;                     // batches held for the collector
+const int TEL_MAX_FIELDS = 7;
+const unsigned long TEL_BATCH_MS = 30000;   // send a batch at least this often
+const unsigned long TEL_RETRY_MIN_MS = 2000;
+const unsigned long TEL_RETRY_MAX_MS = 60000;
+
+enum TelemetryType : uint8_t
+{
+  TEL_STATE,    // state
+  TEL_DISTANCE, // samples, A min/mean/max mm, B min/mean/max mm
+  TEL_ROAD,     // vehicles (running total), occupancy per mille, present
+  TEL_METRICS,  // ticks (running total), max tick ms, free heap, e-stop trips, commands applied
+  TEL_TYPES
+};
+
+const uint8_t TEL_FIELDS[TEL_TYPES] = {1, 7, 3, 5};
+const size_t TEL_MAX_RECORD = 5 + TEL_MAX_FIELDS * 5;
+
+struct TelemetryBatch
+{
+  uint32_t seq;
+  uint16_t len;
+  uint16_t records;
+  unsigned long openedMs;
+  unsigned long lastMs; // last record
+  unsigned long sentMs; // 0: not sent yet
+  uint8_t buf[TEL_BATCH_BYTES];
+};
+
+// Builds batches; no I/O, so host tools can use it to make traffic
+class TelemetryWriter
+{
+public:
+  explicit TelemetryWriter(uint32_t device = 0) : device_(device) {}
+
+  void setDevice(uint32_t device) { device_ = device; }
+  void setBoot(uint32_t boot) { boot_ = boot; }
+
+  // Starts b as the next batch
+  void open(TelemetryBatch &b, unsigned long now)
+  {
+    b.seq = ++seq_;
+    b.len = TEL_HEADER_BYTES;
+    b.records = 0;
+    b.openedMs = b.lastMs = now;
+    b.sentMs = 0;
+    memset(prev_, 0, sizeof(prev_));
+    uint8_t *p = b.buf;
+    p[0] = 'B';
+    p[1] = 'T';
+    p[2] = TEL_VERSION;
+    p[3] = 0;
+    put32(p + 4, device_);
+    put32(p + 8, b.seq);
+    put32(p + 12, (uint32_t)now);
+    put32(p + 16, 0);
+    put32(p + 20, boot_);
+  }
+
+  bool fits(const TelemetryBatch &b) const { return b.len + TEL_MAX_RECORD <= TEL_BATCH_BYTES; }
+
+  // Appends one record; the caller checked fits()
+  void add(TelemetryBatch &b, TelemetryType type, const int32_t *fields, unsigned long now)
+  {
+    if ((long)(now - b.lastMs) < 0)
+      now = b.lastMs; // stamped earlier in the same tick
+    uint8_t *p = b.buf + b.len;
+    size_t n = putVarint(p, (uint32_t)(now - b.lastMs) << 3 | type);
+    for (int i = 0; i < TEL_FIELDS[type]; i++)
+    {
+      int32_t d = (int32_t)((uint32_t)fields[i] - (uint32_t)prev_[type][i]);
+      n += putVarint(p + n, ((uint32_t)d << 1) ^ (uint32_t)(d >> 31));
+      prev_[type][i] = fields[i];
+    }
+    b.len += (uint16_t)n;
+    b.lastMs = now;
+    b.records++;
+    b.buf[16] = (uint8_t)b.records;
+    b.buf[17] = (uint8_t)(b.records >> 8);
+  }
+
+  uint32_t device() const { return device_; }
+  uint32_t boot() const { return boot_; }
+
+  static void put32(uint8_t *p, uint32_t v)
+  {
+    for (int i = 0; i < 4; i++)
+      p[i] = (uint8_t)(v >> (8 * i));
+  }
+  static uint32_t get32(const uint8_t *p) { return p[0] | p[1] << 8 | p[2] << 16 | (uint32_t)p[3] << 24; }
+
+private:
+  static size_t putVarint(uint8_t *p, uint32_t v)
+  {
+    size_t n = 0;
+    while (v >= 0x80)
+    {
+      p[n++] = (uint8_t)(v | 0x80);
+      v >>= 7;
+    }
+    p[n++] = (uint8_t)v;
+    return n;
+  }
+
+  uint32_t device_;
+  uint32_t boot_ = 0;
+  uint32_t seq_ = 0;
+  int32_t prev_[TEL_TYPES][TEL_MAX_FIELDS];
+};
+
+class TelemetryUplink
+{
+public:
+  // Collector address; port 0 turns the uplink off
+  void configure(uint32_t device, IPAddress collector, uint16_t port, unsigned long batchMs)
+  {
+    writer_.setDevice(device);
+    if (writer_.boot() == 0)
+      writer_.setBoot(esp_random() | 1); // kept on a reconfigure: seqs carry on
+    collector_ = collector;
+    port_ = port;
+    batchMs_ = batchMs ? batchMs : TEL_BATCH_MS;
+    retryMs_ = TEL_RETRY_MIN_MS;
+    nextRetryMs_ = 0;
+  }
+
+  bool enabled() const { return port_ != 0; }
+
+  void record(TelemetryType type, const int32_t *fields, unsigned long now)
+  {
+    if (!enabled())
+      return;
+    if (open_ >= 0 && !writer_.fits(ring_[open_]))
+      close();
+    if (open_ < 0)
+    {
+      open_ = freeSlot();
+      writer_.open(ring_[open_], now);
+    }
+    writer_.add(ring_[open_], type, fields, now);
+    records_++;
+  }
+
+  // Closes the open batch now, for events worth a wakeup of their own
+  void flush()
+  {
+    if (open_ >= 0)
+      close();
+  }
+
+  // Call every tick: closes an old batch, reads acks, sends what is due
+  void service(unsigned long now, bool linkUp)
+  {
+    if (!enabled())
+      return;
+    if (open_ >= 0 && now - ring_[open_].openedMs >= batchMs_)
+      close();
+    if (!linkUp)
+      return;
+    if (!socket_)
+      socket_ = udp_.begin(0) != 0;
+    if (!socket_)
+      return;
+
+    uint8_t ack[TEL_ACK_BYTES];
+    while (udp_.parsePacket() > 0)
+    {
+      int n = udp_.read(ack, sizeof(ack));
+      udp_.flush();
+      if (n == (int)TEL_ACK_BYTES && ack[0] == 'B' && ack[1] == 'A' && ack[2] == TEL_VERSION &&
+          TelemetryWriter::get32(ack + 4) == writer_.device())
+        acked(TelemetryWriter::get32(ack + 8), now);
+    }
+
+    // New batches go straight out; on a retry, everything unacked goes in
+    // one burst, so one wakeup covers the backlog
+    bool retry = (long)(now - nextRetryMs_) >= 0;
+    bool any = false;
+    for (int i = 0; i < pending_; i++)
+    {
+      TelemetryBatch &b = ring_[(first_ + i) % TEL_RING];
+      if (b.sentMs == 0 || retry)
+      {
+        send(b, now);
+        any = true;
+      }
+    }
+    if (any && retry)
+    {
+      nextRetryMs_ = now + retryMs_;
+      retryMs_ = retryMs_ * 2 > TEL_RETRY_MAX_MS ? TEL_RETRY_MAX_MS : retryMs_ * 2;
+    }
+    else if (any)
+      nextRetryMs_ = now + retryMs_;
+  }
+
+  int pending() const { return pending_; }
+  uint32_t records() const { return records_; }
+  uint32_t batchesSent() const { return sent_; }
+  uint32_t batchesAcked() const { return acked_; }
+  uint32_t batchesDropped() const { return dropped_; }
+  uint32_t bytesSent() const { return bytes_; }
+
+private:
+  // Ring: pending_ closed batches from first_, then the open one if any
+  int freeSlot()
+  {
+    if (pending_ == TEL_RING)
+    {
+      // Collector unreachable for long: drop the oldest
+      first_ = (first_ + 1) % TEL_RING;
+      pending_--;
+      dropped_++;
+    }
+    return (first_ + pending_) % TEL_RING;
+  }
+
+  void close()
+  {
+    open_ = -1;
+    pending_++;
+  }
+
+  void send(TelemetryBatch &b, unsigned long now)
+  {
+    b.sentMs = now ? now : 1;
+    udp_.beginPacket(collector_, port_);
+    udp_.write(b.buf, b.len);
+    if (udp_.endPacket())
+    {
+      sent_++;
+      bytes_ += b.len;
+    }
+  }
+
+  void acked(uint32_t seq, unsigned long now)
+  {
+    for (int i = 0; i < pending_; i++)
+    {
+      int at = (first_ + i) % TEL_RING;
+      if (ring_[at].seq != seq)
+        continue;
+      // Close the gap, keeping the ring in order
+      for (int j = i; j > 0; j--)
+        ring_[(first_ + j) % TEL_RING] = ring_[(first_ + j - 1) % TEL_RING];
+      first_ = (first_ + 1) % TEL_RING;
+      pending_--;
+      acked_++;
+      retryMs_ = TEL_RETRY_MIN_MS; // collector is back: resend the rest soon
+      nextRetryMs_ = now + retryMs_;
+      return;
+    }
+  }
+
+  TelemetryWriter writer_;
+  WiFiUDP udp_;
+  bool socket_ = false;
+  IPAddress collector_;
+  uint16_t port_ = 0;
+  unsigned long batchMs_ = TEL_BATCH_MS;
+  TelemetryBatch ring_[TEL_RING];
+  int first_ = 0;
+  int pending_ = 0;
+  int open_ = -1;
+  unsigned long retryMs_ = TEL_RETRY_MIN_MS;
+  unsigned long nextRetryMs_ = 0;
+  uint32_t records_ = 0, sent_ = 0, acked_ = 0, dropped_ = 0, bytes_ = 0;
+};
@@ -0,0 +1,669 @@
+// Generated by tools/embed_assets.py from data/. Do not edit by hand:
+// change the files in data/ and re-run the script.
+#pragma once
+
+#include <Arduino.h>
+
+struct WebAsset
+{
+  const char *path;
+  const char *mime;
+  const char *etag;  // quoted, ready for the ETag header
+  const uint8_t *gz; // gzip-compressed body
+  size_t len;
+};
+
+// bridgeController.js: 1328 bytes, 597 gzipped
+constexpr uint8_t asset_bridgeController_js[] PROGMEM = {
+  0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0x85, 0x54, 0x51, 0x73, 0xda, 0x30,
+  0x0c, 0x7e, 0xe7, 0x57, 0x68, 0xf0, 0x10, 0x78, 0x18, 0x6c, 0x6c, 0xb0, 0x1b, 0x04, 0x76, 0xb4,
+  0x65, 0x5b, 0xee, 0x68, 0xd9, 0x15, 0xba, 0x3d, 0xb6, 0xc1, 0x51, 0x20, 0x37, 0x63, 0x33, 0x5b,
+  0xd9, 0xe0, 0xd6, 0xfe, 0xf7, 0xd9, 0x49, 0x48, 0x0c, 0x77, 0x5d, 0x79, 0x08, 0x67, 0xeb, 0xd3,
+  0x27, 0xe9, 0x93, 0x64, 0xc6, 0x43, 0xad, 0xe1, 0x3b, 0x2a, 0x4a, 0x58, 0xc8, 0x67, 0x49, 0x4c,
+  0x17, 0x2a, 0x89, 0xd6, 0x78, 0x29, 0x05, 0x29, 0xc9, 0x39, 0x2a, 0xf8, 0x5b, 0x03, 0x60, 0x52,
+  0x68, 0x52, 0x29, 0x23, 0xa9, 0x9a, 0x4a, 0x4a, 0x9a, 0x72, 0xdc, 0xa2, 0xa0, 0x20, 0x6a, 0x65,
+  0x66, 0x00, 0xda, 0x24, 0xba, 0x6d, 0x2d, 0x30, 0x82, 0x48, 0xb2, 0xd4, 0x5a, 0xdb, 0x6b, 0x3c,
+  0x02, 0x2f, 0x0e, 0x41, 0x74, 0xe6, 0x38, 0xac, 0xfc, 0xb6, 0xa1, 0x48, 0x43, 0x3e, 0x15, 0xe1,
+  0x8a, 0x63, 0x64, 0x08, 0xe2, 0x90, 0x6b, 0x74, 0xec, 0x9a, 0x42, 0xc2, 0x25, 0xee, 0x2d, 0xb9,
+  0x17, 0x5c, 0xcd, 0xa6, 0x9e, 0x63, 0xbc, 0x57, 0x28, 0x22, 0x54, 0x77, 0x41, 0x33, 0xa3, 0x7c,
+  0xaa, 0x99, 0x8f, 0x46, 0xba, 0x76, 0x39, 0x9b, 0x98, 0xff, 0x9f, 0x64, 0x7b, 0x1e, 0xb5, 0xc0,
+  0xe4, 0xd4, 0x59, 0xc1, 0x90, 0x88, 0x58, 0x1a, 0x4b, 0x59, 0x5c, 0xfb, 0x57, 0x8a, 0xea, 0xb0,
+  0x40, 0x8e, 0x99, 0x12, 0x5e, 0x83, 0x1b, 0xc1, 0x02, 0x03, 0xf2, 0x8a, 0x72, 0x92, 0x18, 0x9a,
+  0xd6, 0xe9, 0x18, 0x08, 0x32, 0x8a, 0x36, 0x99, 0xdc, 0xad, 0xa2, 0xa6, 0xf2, 0x2a, 0x50, 0x01,
+  0x00, 0xf8, 0x04, 0x5e, 0x21, 0xb7, 0x3e, 0xda, 0xa0, 0x99, 0xe7, 0x0f, 0x5b, 0x19, 0x61, 0xcb,
+  0x2b, 0xa1, 0x03, 0x07, 0xca, 0x25, 0xfb, 0x69, 0x91, 0x93, 0x94, 0xe4, 0x36, 0x34, 0xfd, 0x2b,
+  0xc0, 0x43, 0x37, 0xb2, 0xa6, 0x03, 0xc7, 0x36, 0x93, 0x5c, 0xaa, 0x2a, 0xb2, 0x8d, 0xc8, 0x93,
+  0xf5, 0x86, 0xd6, 0x0a, 0x51, 0x78, 0x96, 0xb5, 0xc1, 0x56, 0x51, 0x0f, 0xdf, 0x16, 0xce, 0x4f,
+  0x8e, 0x90, 0x8b, 0xa3, 0xf8, 0x4d, 0x3a, 0x91, 0xcf, 0x6d, 0x0a, 0xc1, 0xe3, 0xe3, 0x49, 0x67,
+  0x72, 0xf9, 0x34, 0xbd, 0x28, 0x9e, 0x65, 0x4f, 0xb5, 0x2b, 0xdf, 0x2b, 0x6d, 0xe2, 0x28, 0xa4,
+  0x54, 0x89, 0xfc, 0x52, 0xd3, 0x99, 0x7e, 0xa7, 0xe1, 0x87, 0xb5, 0x0c, 0xc5, 0x91, 0x80, 0xd9,
+  0xf9, 0x68, 0x60, 0x0f, 0x3f, 0xe0, 0xca, 0xab, 0x18, 0x8d, 0xcf, 0xc8, 0x18, 0xe6, 0xdf, 0xa6,
+  0x37, 0xc1, 0xcd, 0x17, 0xaf, 0x55, 0xe0, 0xba, 0x5d, 0xd6, 0xeb, 0x61, 0x81, 0x43, 0x33, 0x71,
+  0x2e, 0xf8, 0x72, 0x36, 0x5f, 0xb8, 0x60, 0x8c, 0xdf, 0x9b, 0xdf, 0x33, 0xe0, 0xcf, 0x93, 0xbb,
+  0xd9, 0xb2, 0x84, 0x46, 0xac, 0xdb, 0xef, 0xf6, 0x9f, 0x81, 0x5e, 0xcc, 0x27, 0xcb, 0xfb, 0x1f,
+  0x93, 0xdb, 0x2c, 0x13, 0xab, 0x5a, 0x71, 0x7f, 0x3b, 0x9f, 0x5c, 0x95, 0xf7, 0x47, 0xa6, 0xb8,
+  0xf7, 0x11, 0xdf, 0x1c, 0x2b, 0x31, 0x32, 0x9c, 0x36, 0x93, 0x95, 0xe3, 0xee, 0xac, 0xc0, 0xf9,
+  0x3a, 0xb6, 0x13, 0x21, 0x50, 0x7d, 0x5d, 0x5e, 0xcf, 0x8c, 0xc7, 0x43, 0x31, 0x19, 0x7e, 0x94,
+  0xfc, 0x06, 0x66, 0x37, 0x7f, 0x54, 0xff, 0x63, 0xb7, 0x9d, 0xea, 0xe3, 0x72, 0xc4, 0xfc, 0xcd,
+  0xbb, 0x71, 0xfe, 0x06, 0x80, 0x7d, 0x0e, 0xfc, 0x8e, 0x39, 0x57, 0xc6, 0xdd, 0xd8, 0x37, 0x0f,
+  0x81, 0x14, 0xeb, 0x71, 0xde, 0xb9, 0x81, 0xdf, 0x29, 0xce, 0xe0, 0xeb, 0x5d, 0x28, 0x20, 0x89,
+  0x46, 0xf5, 0xaa, 0xb1, 0xf5, 0xb1, 0x1d, 0x0a, 0x83, 0x31, 0xa6, 0xb1, 0xdf, 0xd9, 0xb9, 0x4c,
+  0x25, 0xd4, 0x2e, 0x50, 0x1d, 0xb2, 0xe2, 0x46, 0xf5, 0x6d, 0xa8, 0xd6, 0x89, 0x78, 0x4d, 0x72,
+  0x37, 0xe8, 0xef, 0xf6, 0xc3, 0xac, 0xd8, 0x41, 0x31, 0x9d, 0x4e, 0x96, 0x00, 0x2f, 0xed, 0x41,
+  0x15, 0xa9, 0x0a, 0xeb, 0x77, 0x4c, 0xe5, 0xf9, 0xe1, 0x21, 0x57, 0xcf, 0xe8, 0x87, 0xfb, 0x9d,
+  0x54, 0x04, 0x11, 0xc6, 0x61, 0xca, 0xe9, 0xbf, 0x6f, 0xe1, 0xb0, 0xf6, 0x0f, 0xaf, 0x57, 0xde,
+  0xc0, 0x30, 0x05, 0x00, 0x00,
+};
+
+// index.html: 19310 bytes, 5324 gzipped
+constexpr uint8_t asset_index_html[] PROGMEM = {
+  0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0xc5, 0x3c, 0xe9, 0x72, 0xe3, 0x36,
+  0xd2, 0xff, 0xe7, 0x29, 0x30, 0x9a, 0x43, 0xe4, 0x46, 0xa4, 0x28, 0x59, 0xf2, 0x21, 0x5f, 0xeb,
+  0x43, 0x33, 0xf1, 0x96, 0x3d, 0x76, 0xd9, 0xca, 0xf7, 0xed, 0x56, 0x2a, 0x95, 0x81, 0x44, 0x48,
+  0xe2, 0x0e, 0x45, 0x2a, 0x24, 0x65, 0x8d, 0xd7, 0x51, 0xd5, 0x3e, 0xc4, 0x3e, 0xe1, 0x3e, 0xc9,
+  0x76, 0x03, 0x3c, 0x00, 0x90, 0x92, 0xed, 0xc9, 0x26, 0x3b, 0x93, 0xd8, 0x12, 0x80, 0x6e, 0x34,
+  0xfa, 0xee, 0x06, 0x39, 0x07, 0xaf, 0xcf, 0xaf, 0xcf, 0x06, 0x7f, 0xbb, 0xe9, 0x93, 0x69, 0x32,
+  0xf3, 0x8f, 0x5e, 0x1d, 0xe0, 0x2f, 0xe2, 0xd3, 0x60, 0x72, 0x58, 0x63, 0x41, 0x0d, 0x07, 0x18,
+  0x75, 0x8f, 0x5e, 0x11, 0x72, 0x30, 0x63, 0x09, 0x25, 0xa3, 0x29, 0x8d, 0x62, 0x96, 0x1c, 0xd6,
+  0x7e, 0x18, 0x7c, 0xb0, 0x76, 0x6b, 0xa4, 0x59, 0x4c, 0x05, 0x74, 0xc6, 0x0e, 0x6b, 0xf7, 0x1e,
+  0x5b, 0xce, 0xc3, 0x28, 0xa9, 0x91, 0x51, 0x18, 0x24, 0x2c, 0x80, 0xa5, 0x4b, 0xcf, 0x4d, 0xa6,
+  0x87, 0x2e, 0xbb, 0xf7, 0x46, 0xcc, 0xe2, 0x5f, 0x1a, 0xc4, 0x0b, 0xbc, 0xc4, 0xa3, 0xbe, 0x15,
+  0x8f, 0xa8, 0xcf, 0x0e, 0x5b, 0xb6, 0x53, 0x13, 0x98, 0x12, 0x2f, 0xf1, 0xd9, 0x51, 0xff, 0xee,
+  0x66, 0xab, 0x4d, 0x4e, 0x23, 0xcf, 0x9d, 0x30, 0x72, 0x06, 0x78, 0xa2, 0xd0, 0xf7, 0x59, 0x74,
+  0xd0, 0x14, 0xd3, 0xaf, 0x70, 0x65, 0x9c, 0x3c, 0xe0, 0x47, 0x02, 0x7f, 0x9a, 0x7f, 0x22, 0x87,
+  0xf8, 0x87, 0x0c, 0x69, 0xcc, 0xc8, 0x9c, 0x02, 0x90, 0xf8, 0xfe, 0xa7, 0x26, 0x9f, 0x1f, 0x86,
+  0xee, 0x03, 0x79, 0xe4, 0x1f, 0x09, 0x19, 0x03, 0x3a, 0x6b, 0x4c, 0x67, 0x9e, 0xff, 0xd0, 0x23,
+  0x27, 0x11, 0x10, 0xd1, 0x20, 0x31, 0x0d, 0x62, 0x2b, 0x66, 0x91, 0x37, 0xde, 0x4f, 0x57, 0x0d,
+  0xe9, 0xe8, 0xcb, 0x24, 0x0a, 0x17, 0x81, 0xdb, 0x23, 0xbe, 0x17, 0x30, 0x1a, 0x59, 0x93, 0x88,
+  0xba, 0x1e, 0x1c, 0xc8, 0x48, 0x42, 0x12, 0x79, 0x93, 0x69, 0xd2, 0x20, 0x6f, 0x5a, 0x9d, 0x16,
+  0xdb, 0x72, 0xf0, 0x43, 0xb7, 0x3d, 0xea, 0x6c, 0x9b, 0x19, 0xf8, 0x28, 0xf4, 0xc3, 0xa8, 0x47,
+  0x96, 0x53, 0x2f, 0x61, 0xd9, 0xd8, 0x8c, 0x46, 0x13, 0x2f, 0xe8, 0x11, 0x27, 0x1b, 0x98, 0x53,
+  0xd7, 0xf5, 0x82, 0x49, 0x8f, 0xb4, 0x3b, 0xf3, 0xaf, 0xa4, 0xb5, 0x3d, 0xff, 0x2a, 0x66, 0x56,
+  0xaf, 0xf8, 0xaf, 0x69, 0x2b, 0xa7, 0x39, 0x07, 0x85, 0xbf, 0xb8, 0xae, 0xc0, 0x91, 0xb0, 0xaf,
+  0x89, 0x45, 0x7d, 0x6f, 0x02, 0xb3, 0x23, 0x20, 0x8e, 0x45, 0x1a, 0x09, 0x6f, 0xc6, 0xe3, 0xfc,
+  0x50, 0xfc, 0xe8, 0x4b, 0x86, 0xb4, 0xf7, 0xc8, 0xae, 0xe3, 0x28, 0xdb, 0xe5, 0x4c, 0x9c, 0x51,
+  0x2f, 0xe0, 0xc2, 0x83, 0xdf, 0x2c, 0x22, 0x34, 0x70, 0xc9, 0x88, 0x46, 0x6e, 0xac, 0xf2, 0xd4,
+  0x9e, 0xd3, 0x80, 0xf9, 0x39, 0x85, 0x5c, 0xac, 0x3d, 0xd2, 0x72, 0x9c, 0x77, 0xc5, 0x79, 0xbf,
+  0x5a, 0xe9, 0xf0, 0x8e, 0xe3, 0x64, 0x87, 0x93, 0x0f, 0x43, 0x17, 0x49, 0x58, 0x62, 0x46, 0xc1,
+  0x07, 0x14, 0xdc, 0x57, 0x2b, 0x9e, 0x52, 0x37, 0x5c, 0xa6, 0x67, 0x87, 0xa3, 0xbf, 0x71, 0x1c,
+  0x3a, 0x2c, 0xce, 0x34, 0x0c, 0x23, 0x97, 0x45, 0x16, 0xca, 0x66, 0x11, 0x03, 0x74, 0x47, 0x82,
+  0x96, 0x64, 0x18, 0x4d, 0x86, 0xd4, 0x68, 0x3b, 0xad, 0x06, 0x29, 0x7e, 0x38, 0xf6, 0x56, 0x37,
+  0x97, 0x98, 0xeb, 0xc5, 0x73, 0x9f, 0x82, 0x4a, 0x4c, 0x40, 0xeb, 0xb2, 0xc1, 0x09, 0x9d, 0xf7,
+  0xca, 0x82, 0xb1, 0x91, 0x1d, 0xf9, 0xc9, 0x4b, 0xbb, 0x80, 0x3a, 0xa4, 0xff, 0xd9, 0x3b, 0xe6,
+  0x13, 0xc7, 0x53, 0x69, 0x6f, 0xaf, 0x3f, 0x79, 0x1b, 0x39, 0x98, 0xe3, 0x6f, 0xed, 0xe0, 0x19,
+  0xba, 0x5d, 0x7e, 0x06, 0x53, 0x25, 0x6e, 0xc8, 0xad, 0xc6, 0x42, 0xb3, 0x05, 0xe9, 0x3d, 0xea,
+  0xc7, 0x1b, 0xfb, 0x2c, 0xdf, 0x84, 0xeb, 0x8d, 0x05, 0x2a, 0x3a, 0x8b, 0x75, 0xed, 0xf9, 0xfb,
+  0x22, 0x4e, 0xbc, 0xf1, 0x83, 0x95, 0x1a, 0x71, 0x8f, 0xc4, 0x73, 0x0a, 0xd6, 0x3b, 0x64, 0xc9,
+  0x92, 0xb1, 0x40, 0xe5, 0x8f, 0x44, 0x36, 0x62, 0xb7, 0x96, 0x11, 0x0e, 0xe3, 0xcf, 0x6a, 0x05,
+  0x1b, 0x2e, 0x92, 0x24, 0x0c, 0x74, 0x7d, 0x1a, 0x26, 0x81, 0x15, 0x85, 0xcb, 0xcd, 0x14, 0x8b,
+  0x0d, 0x4b, 0xca, 0x64, 0x25, 0xe1, 0x0b, 0x08, 0x11, 0xfb, 0xe7, 0x1b, 0x15, 0xa2, 0x69, 0x2b,
+  0x66, 0x58, 0x68, 0xaa, 0x62, 0x71, 0x42, 0x68, 0x3d, 0x12, 0x84, 0x01, 0x5b, 0x23, 0xc8, 0xdd,
+  0x6a, 0x1d, 0xd4, 0x34, 0x77, 0x9d, 0x81, 0xc6, 0xde, 0x3f, 0x98, 0xaa, 0x27, 0xa3, 0x45, 0x14,
+  0xe3, 0xd2, 0x79, 0xe8, 0xc9, 0x32, 0x4a, 0x22, 0x70, 0x5b, 0xe0, 0x46, 0x43, 0x20, 0xd1, 0x6e,
+  0x77, 0xe3, 0x8a, 0x43, 0xf6, 0xa6, 0xe1, 0xbd, 0xa4, 0x05, 0x1a, 0x35, 0xbb, 0xdd, 0xd1, 0xa8,
+  0x0a, 0x88, 0x8e, 0x12, 0xef, 0x9e, 0xad, 0x83, 0xea, 0x8e, 0xf7, 0xf6, 0xaa, 0xa0, 0x40, 0x60,
+  0x74, 0xe8, 0xb3, 0x6a, 0xcb, 0x78, 0xb3, 0xd5, 0xdd, 0xa1, 0xd4, 0xd1, 0x4f, 0x14, 0x84, 0xe8,
+  0xbd, 0xfc, 0x70, 0xc9, 0x72, 0x9b, 0x0b, 0x41, 0xd1, 0xbc, 0x04, 0xe4, 0x6e, 0xef, 0x74, 0x95,
+  0x6d, 0xde, 0xdc, 0x32, 0x88, 0x3c, 0xd5, 0xd8, 0xdd, 0x51, 0x7b, 0xbb, 0xbd, 0xad, 0x2e, 0x07,
+  0x52, 0xee, 0x12, 0x9a, 0x2c, 0x62, 0xcd, 0x8d, 0xa6, 0xca, 0x22, 0x29, 0x91, 0xc4, 0xf6, 0x76,
+  0x47, 0x1b, 0xce, 0xdc, 0xe5, 0x30, 0xf4, 0xdd, 0xa7, 0x9c, 0xae, 0xae, 0xe8, 0x20, 0xa0, 0xf1,
+  0xd8, 0x1b, 0x69, 0x8a, 0x9e, 0x8e, 0x5a, 0xe8, 0x68, 0xca, 0xda, 0xae, 0xb8, 0x1f, 0xf8, 0x6c,
+  0x81, 0x75, 0xc2, 0x4c, 0xc2, 0xc0, 0x14, 0xfd, 0xc5, 0x2c, 0x00, 0xf5, 0x8a, 0xd8, 0x9c, 0xd1,
+  0xc4, 0x68, 0x37, 0xc8, 0xcc, 0x0b, 0xc0, 0xcb, 0x72, 0x8f, 0x30, 0x8e, 0x4c, 0xf3, 0x09, 0xb7,
+  0x95, 0xf8, 0x16, 0xb8, 0x15, 0x32, 0xdd, 0x2a, 0xc5, 0x95, 0x5d, 0x54, 0x70, 0x85, 0x25, 0xeb,
+  0xe3, 0x8a, 0xc2, 0x95, 0xbd, 0x72, 0x10, 0x01, 0x9a, 0xbc, 0xfc, 0xe4, 0x06, 0x68, 0x5f, 0xe2,
+  0x41, 0x8c, 0x37, 0xf3, 0xe3, 0xe3, 0xbc, 0x95, 0xcd, 0xeb, 0xe1, 0x43, 0x26, 0x61, 0x9a, 0xee,
+  0xd1, 0xe9, 0x3e, 0x1d, 0x3c, 0xc2, 0xcc, 0x0e, 0x22, 0x06, 0xbc, 0x02, 0xe5, 0x5d, 0xe7, 0x62,
+  0x25, 0xd3, 0x54, 0xec, 0xfe, 0x39, 0x71, 0xbf, 0xb5, 0xeb, 0xb8, 0x6c, 0x82, 0xc1, 0xbe, 0x05,
+  0xee, 0xf7, 0x8d, 0x43, 0xf1, 0x2f, 0xd9, 0x76, 0xde, 0x99, 0xd5, 0x5e, 0x1b, 0xb9, 0x8a, 0x1b,
+  0x6a, 0x61, 0x01, 0xa3, 0x4e, 0x23, 0x05, 0x90, 0xff, 0x78, 0x01, 0xaa, 0xb7, 0xc3, 0xff, 0x76,
+  0x44, 0xa0, 0x73, 0x76, 0x9e, 0x5a, 0xc8, 0x23, 0x22, 0x78, 0x90, 0xd6, 0xfe, 0x26, 0xb7, 0xc9,
+  0xbd, 0xa1, 0xeb, 0x45, 0x6c, 0x24, 0xb8, 0x24, 0x54, 0xe9, 0x65, 0xbe, 0x7e, 0x6d, 0xb0, 0xc8,
+  0xd4, 0x6b, 0x96, 0x00, 0xc8, 0x3f, 0xa4, 0x9c, 0xa0, 0x90, 0x0a, 0x1d, 0xc6, 0xb0, 0x63, 0x91,
+  0x0a, 0xf1, 0x13, 0xa8, 0x7e, 0x72, 0x43, 0x18, 0x97, 0x98, 0x2a, 0x1f, 0x7d, 0x2b, 0xe5, 0xd1,
+  0xee, 0x73, 0x79, 0x84, 0x6c, 0xa2, 0x85, 0xca, 0x70, 0x5f, 0x6a, 0xb1, 0x7b, 0x38, 0x4a, 0x2c,
+  0xbb, 0x73, 0xe9, 0x3c, 0x3e, 0x9d, 0xcd, 0xcb, 0x26, 0x3a, 0xf4, 0xc3, 0xd1, 0x97, 0x7d, 0x55,
+  0x73, 0x77, 0x2b, 0x14, 0x77, 0xc7, 0x59, 0x7b, 0xbe, 0xbd, 0xbd, 0xbd, 0x35, 0x79, 0x0a, 0x2c,
+  0x80, 0xb4, 0x38, 0xd7, 0xb9, 0x0e, 0x86, 0x7d, 0xfe, 0x83, 0x26, 0x64, 0xab, 0xfb, 0x8e, 0x6c,
+  0x39, 0xef, 0x1a, 0xd9, 0x69, 0xda, 0xe0, 0x02, 0x78, 0x10, 0x98, 0xd3, 0x08, 0x16, 0x93, 0x6e,
+  0xf7, 0x5d, 0xa5, 0x66, 0xbd, 0x69, 0x8d, 0xdb, 0x7b, 0x5b, 0x3b, 0x9b, 0x18, 0x8a, 0x21, 0x0e,
+  0x8d, 0x8f, 0x73, 0x94, 0x6e, 0xe2, 0xa8, 0xc5, 0xd5, 0xba, 0xbd, 0x69, 0xa9, 0xaa, 0xc3, 0xbb,
+  0xd5, 0x6c, 0xfd, 0xae, 0xcc, 0xe1, 0x6a, 0xff, 0xac, 0x01, 0xda, 0x11, 0x73, 0x6d, 0x29, 0x7c,
+  0x6f, 0xe4, 0x1e, 0xd2, 0xc0, 0x7f, 0x20, 0xf7, 0xda, 0xef, 0x48, 0x7b, 0x37, 0xe5, 0xde, 0xf6,
+  0x33, 0x39, 0xc7, 0xc6, 0x1d, 0xf8, 0xf3, 0x87, 0x72, 0x8e, 0xbb, 0x8c, 0x4e, 0xe6, 0x36, 0xda,
+  0x5b, 0x7b, 0x0d, 0xb2, 0xbd, 0x2b, 0xfe, 0xb7, 0xb7, 0xcd, 0x6f, 0xe5, 0xb7, 0xfd, 0xc0, 0x30,
+  0xce, 0xfe, 0x71, 0x9c, 0x1b, 0x77, 0xf7, 0x98, 0x33, 0xfc, 0x5f, 0x72, 0xae, 0x03, 0xf9, 0x71,
+  0xab, 0x0b, 0x6c, 0x43, 0x77, 0x6d, 0x77, 0xbb, 0xdf, 0xce, 0xbb, 0x49, 0x04, 0x8e, 0xf0, 0x8f,
+  0x63, 0x5d, 0xbb, 0x3d, 0xea, 0x76, 0xd9, 0xff, 0x90, 0x75, 0x5b, 0x1d, 0x60, 0xda, 0xde, 0x4e,
+  0x83, 0xec, 0x75, 0xbe, 0x8d, 0x73, 0x90, 0x07, 0x8c, 0x80, 0x3b, 0x09, 0x10, 0x0d, 0xb5, 0xe4,
+  0xd4, 0x9b, 0xc7, 0x45, 0xfc, 0x4f, 0xac, 0xc4, 0x9b, 0x49, 0x49, 0xe9, 0xfa, 0x30, 0xe1, 0xb3,
+  0x31, 0xb8, 0xd1, 0x6e, 0x51, 0x52, 0x72, 0xee, 0x8d, 0xc3, 0x68, 0xd6, 0x13, 0x1f, 0x31, 0x2f,
+  0xfa, 0xab, 0x61, 0x75, 0x95, 0x10, 0x0c, 0xc9, 0xe8, 0x4c, 0x2b, 0x12, 0xc0, 0xa9, 0xa4, 0x7e,
+  0xba, 0xb3, 0xfd, 0x9c, 0x1c, 0x27, 0x4f, 0x0d, 0xf0, 0x74, 0x1b, 0xa2, 0x94, 0x96, 0x43, 0x42,
+  0xa5, 0xe0, 0x38, 0x3c, 0x76, 0x35, 0x5b, 0x76, 0x9b, 0xc4, 0x0f, 0x31, 0x44, 0x4b, 0x6b, 0xe1,
+  0x35, 0xd6, 0xf7, 0x19, 0xb2, 0x22, 0x80, 0x75, 0xd9, 0x0e, 0x1b, 0xae, 0xaf, 0x5c, 0xc1, 0xfe,
+  0xa1, 0xe2, 0xdb, 0x02, 0x69, 0xec, 0x98, 0x7a, 0x25, 0x82, 0xf1, 0x0d, 0x18, 0x07, 0xd9, 0x24,
+  0x5f, 0xdb, 0xea, 0xa0, 0xca, 0x6f, 0xc3, 0xda, 0xd6, 0x2e, 0x8a, 0xaf, 0x5d, 0x14, 0xb9, 0x88,
+  0xd7, 0x8d, 0xc2, 0xb9, 0x35, 0xf6, 0xfc, 0x04, 0x41, 0x87, 0xfe, 0x22, 0x32, 0x40, 0x39, 0x4c,
+  0x5d, 0x7a, 0xf1, 0x0c, 0xd2, 0x72, 0x12, 0x8f, 0x50, 0xf1, 0x73, 0xd9, 0xfd, 0x79, 0xc6, 0x40,
+  0xd5, 0x89, 0x21, 0x55, 0xf6, 0xdd, 0x36, 0xf0, 0xc0, 0xcc, 0x65, 0x59, 0x9d, 0xdc, 0xae, 0xcd,
+  0x64, 0x21, 0x6b, 0xcd, 0x48, 0x5b, 0xe9, 0x69, 0x64, 0xe8, 0x32, 0x92, 0x84, 0x93, 0x89, 0xcf,
+  0x0a, 0xd5, 0x81, 0x31, 0x2b, 0x1d, 0xfb, 0xd6, 0xc2, 0x56, 0xab, 0x20, 0x73, 0x4b, 0x47, 0xd4,
+  0x3e, 0x1d, 0x4a, 0xe9, 0x8b, 0x92, 0xe8, 0xee, 0x38, 0x8e, 0x2e, 0x32, 0x77, 0xc8, 0xe8, 0x58,
+  0xcb, 0x19, 0xe2, 0xa5, 0x97, 0x8c, 0xa6, 0x15, 0xaa, 0xad, 0xe7, 0xa5, 0x39, 0xd9, 0x5e, 0x80,
+  0x69, 0xa6, 0xf5, 0x4c, 0xea, 0x33, 0xae, 0x77, 0xca, 0xd9, 0xc6, 0x56, 0xe9, 0x4c, 0x29, 0x31,
+  0x5e, 0x30, 0x5f, 0x24, 0xcf, 0x4f, 0xca, 0x9c, 0x52, 0x21, 0xe6, 0x6c, 0xac, 0x43, 0xf3, 0xdd,
+  0x40, 0x01, 0x2b, 0xad, 0x5a, 0x3f, 0x7a, 0x45, 0xab, 0x28, 0x3b, 0x83, 0x3c, 0xa6, 0xd4, 0x77,
+  0xdb, 0x9d, 0x9d, 0xce, 0xee, 0xb0, 0xaa, 0xf0, 0x2d, 0x96, 0x81, 0xa6, 0xc7, 0x0d, 0xc9, 0x5b,
+  0xe2, 0xf7, 0xa7, 0xd3, 0x2f, 0x95, 0xfc, 0xde, 0x90, 0x81, 0x7b, 0x61, 0xcf, 0xe0, 0x56, 0x9e,
+  0x2c, 0xd7, 0x6a, 0xfa, 0x29, 0xda, 0x52, 0x3d, 0x91, 0x1e, 0x56, 0x1e, 0x12, 0x5e, 0x4d, 0x92,
+  0x20, 0xcf, 0x77, 0xd6, 0xf4, 0xad, 0x94, 0x0e, 0xa2, 0x7c, 0xee, 0xdc, 0x15, 0x6e, 0x38, 0xa6,
+  0xe4, 0x39, 0xd5, 0xca, 0x04, 0x3d, 0xc6, 0x56, 0xb9, 0x30, 0x69, 0x9b, 0xeb, 0x15, 0xa8, 0x37,
+  0x9a, 0xb2, 0xd1, 0x17, 0xa8, 0xee, 0xbf, 0x2b, 0x89, 0x5a, 0x91, 0x54, 0xcb, 0x19, 0xee, 0xed,
+  0xb6, 0x5e, 0x82, 0x47, 0xe7, 0x79, 0xb5, 0x93, 0xc7, 0xc2, 0x5c, 0x23, 0x6f, 0x0a, 0x5a, 0x58,
+  0x99, 0x3b, 0x4a, 0x1e, 0x3b, 0x33, 0xd6, 0xd1, 0xd0, 0xed, 0xb2, 0x56, 0x45, 0xc1, 0x6f, 0xef,
+  0x45, 0x6c, 0xf6, 0xcc, 0xc2, 0x3e, 0xeb, 0xad, 0x45, 0x61, 0x98, 0x10, 0x7b, 0x89, 0x9f, 0xab,
+  0x09, 0x90, 0xcb, 0x97, 0x34, 0x96, 0x94, 0xbb, 0x0e, 0xa9, 0xb0, 0xc4, 0x38, 0x08, 0xc3, 0xa5,
+  0xf1, 0x94, 0xa5, 0x3e, 0x9c, 0xf7, 0xf6, 0x8a, 0x1f, 0x8e, 0x24, 0x1a, 0x42, 0x0e, 0x9a, 0x69,
+  0xef, 0xfb, 0xa0, 0x29, 0x9a, 0xf3, 0xaf, 0x0e, 0xb0, 0xc3, 0xcd, 0xfb, 0xe7, 0xd3, 0xd6, 0x51,
+  0x45, 0xdb, 0x1c, 0x46, 0x79, 0xcf, 0xdc, 0xf5, 0xee, 0xc9, 0xc8, 0xa7, 0x71, 0x7c, 0x58, 0xe3,
+  0xed, 0xdb, 0x9a, 0xe8, 0x9f, 0x1f, 0xbc, 0xb6, 0x2c, 0x32, 0xb8, 0x3d, 0xf9, 0xf0, 0xe1, 0xe2,
+  0x8c, 0x5c, 0x5e, 0x7c, 0xfc, 0x7e, 0x70, 0x47, 0x2c, 0x2b, 0x9d, 0x93, 0x60, 0xb0, 0xef, 0x99,
+  0x82, 0xe0, 0x56, 0xed, 0xa3, 0x41, 0x5a, 0xc6, 0x5f, 0xa2, 0xe2, 0xc7, 0xb0, 0x4f, 0xfb, 0xe8,
+  0x55, 0x36, 0x2d, 0xc1, 0xc9, 0x41, 0x21, 0x87, 0x4f, 0xb7, 0xbd, 0xbd, 0x3e, 0x39, 0x27, 0xa7,
+  0xd7, 0x7f, 0xcd, 0x37, 0x2c, 0x01, 0xf3, 0xae, 0x85, 0x04, 0x86, 0x5b, 0x6f, 0x1d, 0xdd, 0x86,
+  0xd4, 0x25, 0xc6, 0x19, 0x8d, 0x62, 0xf2, 0x9e, 0xdc, 0x30, 0x97, 0xc5, 0x09, 0xc4, 0xd8, 0x20,
+  0x36, 0x81, 0x8a, 0x2d, 0x65, 0xb1, 0x84, 0x4b, 0xee, 0x3d, 0xd4, 0x08, 0x05, 0x00, 0xe1, 0xf3,
+  0x0f, 0x6b, 0x1c, 0x5d, 0xd6, 0x95, 0x88, 0x41, 0x01, 0xa8, 0xaf, 0x6c, 0xa9, 0xe1, 0x49, 0x4b,
+  0xdd, 0x14, 0xc7, 0xd4, 0x73, 0x5d, 0x16, 0xe0, 0x39, 0x17, 0xac, 0x76, 0x74, 0xd0, 0x84, 0x95,
+  0x15, 0xb0, 0x9e, 0x7b, 0x58, 0x8b, 0x60, 0x1b, 0x0b, 0x0a, 0x98, 0x1a, 0xd7, 0xcd, 0x1c, 0x19,
+  0xaf, 0x82, 0xb2, 0x61, 0x85, 0x2c, 0x18, 0x7b, 0x1a, 0xa1, 0x48, 0xed, 0x6b, 0x3a, 0xc2, 0x6c,
+  0x58, 0x46, 0xf8, 0x37, 0x31, 0xf6, 0x34, 0x4e, 0x9e, 0xf2, 0xd6, 0x4a, 0x44, 0x66, 0xc3, 0x32,
+  0xce, 0x8f, 0x7c, 0x6c, 0x2d, 0xca, 0x02, 0x03, 0xcf, 0xfb, 0x6a, 0xc5, 0x1e, 0xe2, 0xfb, 0xd1,
+  0xbf, 0xff, 0xf9, 0xaf, 0x12, 0xac, 0x36, 0x90, 0x7e, 0x55, 0x55, 0xe7, 0xee, 0xfb, 0x8b, 0x9b,
+  0x6f, 0x51, 0x9d, 0x3b, 0xc8, 0x47, 0xc9, 0xd9, 0x94, 0x06, 0x60, 0x01, 0xdf, 0xa6, 0x2d, 0x1c,
+  0xc3, 0xef, 0xaf, 0x2d, 0x31, 0x6c, 0xf3, 0x5f, 0xd5, 0x16, 0x8e, 0xf0, 0xbf, 0xac, 0x2d, 0x1c,
+  0xe7, 0xef, 0xac, 0x2d, 0x7c, 0x8f, 0x17, 0x6b, 0x4b, 0xe9, 0x8b, 0xac, 0x45, 0x5c, 0x83, 0x4e,
+  0x6f, 0x2f, 0xce, 0x3f, 0xf6, 0xc9, 0xd9, 0xc9, 0xed, 0xf9, 0x33, 0x1c, 0x9e, 0x34, 0xa1, 0x5c,
+  0xb2, 0xc8, 0x2e, 0x0d, 0x3c, 0xa0, 0xf0, 0xbf, 0xc2, 0x19, 0x56, 0x1e, 0xad, 0xc8, 0x62, 0x6b,
+  0x84, 0x5f, 0x68, 0x1e, 0xd6, 0x06, 0x22, 0xa9, 0x3d, 0x59, 0x40, 0xed, 0x02, 0xc9, 0xd2, 0x88,
+  0x84, 0x11, 0xb9, 0xa2, 0xc1, 0x82, 0xfa, 0x3c, 0x11, 0x56, 0x55, 0x18, 0xea, 0xc7, 0x80, 0xb3,
+  0x05, 0xa7, 0x2e, 0x91, 0xab, 0x35, 0x05, 0x37, 0x67, 0x74, 0xed, 0xe8, 0x0a, 0x3e, 0xf7, 0x0a,
+  0x94, 0x10, 0x35, 0x00, 0x4e, 0x41, 0x24, 0xf2, 0xdd, 0x14, 0x54, 0x04, 0x69, 0x5d, 0x8d, 0x45,
+  0xf2, 0x98, 0x3c, 0xcc, 0x81, 0x48, 0x1e, 0xb9, 0xd1, 0xa0, 0xf2, 0xcd, 0xef, 0x04, 0x8c, 0xb8,
+  0x05, 0xd6, 0x29, 0xcc, 0xf0, 0xf2, 0x20, 0x8f, 0x02, 0x2f, 0xed, 0xdf, 0xe4, 0x04, 0x94, 0xcf,
+  0xa6, 0x50, 0x64, 0x8d, 0xe8, 0x1c, 0x53, 0x1e, 0x38, 0x10, 0x67, 0x88, 0x8e, 0xa7, 0x4a, 0xd8,
+  0xd9, 0xb7, 0x39, 0xa7, 0x34, 0xbf, 0x08, 0xa8, 0x1d, 0x89, 0xdf, 0x3d, 0xc2, 0x95, 0x68, 0x5e,
+  0x29, 0x59, 0x71, 0x0d, 0x25, 0xcb, 0x34, 0xbd, 0x2f, 0x42, 0x54, 0xd7, 0x73, 0xd4, 0xdd, 0xeb,
+  0x9b, 0xfe, 0xa7, 0x83, 0xa6, 0x18, 0xae, 0x5e, 0x77, 0xe6, 0x87, 0x31, 0x48, 0xed, 0xec, 0xf2,
+  0xfa, 0xae, 0xbf, 0x79, 0x25, 0xbf, 0xd4, 0xa8, 0x11, 0xe1, 0x14, 0x8e, 0x6e, 0xfb, 0x77, 0xfd,
+  0x01, 0xe9, 0x5b, 0x77, 0x83, 0xeb, 0x1b, 0x1d, 0x4e, 0x3b, 0x5b, 0x66, 0x7f, 0x42, 0x15, 0x6f,
+  0x21, 0x25, 0xa9, 0x69, 0xda, 0x89, 0x69, 0x8a, 0x66, 0x68, 0xc0, 0x91, 0x74, 0x0d, 0x26, 0x4f,
+  0xc0, 0x0f, 0x48, 0x60, 0x92, 0x30, 0x53, 0x35, 0xf8, 0xc4, 0x02, 0xbc, 0xc3, 0x21, 0x78, 0xc2,
+  0x26, 0xa7, 0x9e, 0x27, 0xba, 0x90, 0x47, 0xc4, 0x76, 0xce, 0xb0, 0xb2, 0x19, 0x5d, 0x9f, 0x0c,
+  0x9e, 0x6b, 0x44, 0x68, 0x20, 0x21, 0x4d, 0x88, 0x90, 0x84, 0x6c, 0x25, 0xa9, 0xb4, 0x86, 0x30,
+  0x7b, 0xee, 0xc5, 0xc9, 0x09, 0x52, 0x17, 0x40, 0xbd, 0x41, 0x4e, 0x7a, 0x80, 0x57, 0x16, 0x97,
+  0xba, 0xf0, 0x34, 0x5f, 0x78, 0xaa, 0x2c, 0xcc, 0x0f, 0x5e, 0xd0, 0x7b, 0x00, 0x05, 0xad, 0x37,
+  0x4f, 0xd2, 0xa7, 0x06, 0x9a, 0xe9, 0xc5, 0xcc, 0xff, 0xa5, 0x77, 0x14, 0x97, 0xde, 0x38, 0x11,
+  0xc6, 0x5b, 0xe4, 0x4e, 0xe2, 0x10, 0xc4, 0x08, 0x42, 0x34, 0xc4, 0x05, 0xb0, 0x26, 0x60, 0x90,
+  0x6c, 0xb8, 0xa6, 0x80, 0x7d, 0x95, 0x7b, 0xe6, 0xcd, 0x58, 0x1e, 0x8b, 0xaa, 0x01, 0xf2, 0x94,
+  0xc5, 0x28, 0x09, 0x23, 0x03, 0xc5, 0xd3, 0xf7, 0xd9, 0x0c, 0xf2, 0xcc, 0x0b, 0xd7, 0x94, 0x8a,
+  0xe5, 0x64, 0xea, 0xc5, 0x36, 0xcf, 0x31, 0x0f, 0x89, 0x1b, 0x8e, 0x16, 0xb8, 0xc2, 0x86, 0x54,
+  0x33, 0x5d, 0x7c, 0xfa, 0x70, 0xe1, 0x6a, 0xc0, 0xfb, 0x2a, 0xec, 0x8c, 0x8b, 0xb3, 0x1f, 0x88,
+  0xeb, 0xb8, 0x43, 0x32, 0xa6, 0x7e, 0xcc, 0xb4, 0x35, 0x31, 0xf0, 0x9f, 0x0d, 0x20, 0xdf, 0x85,
+  0xf9, 0xfa, 0xc5, 0xf9, 0x65, 0xbf, 0xae, 0x2d, 0xf8, 0x39, 0x62, 0x01, 0x18, 0xee, 0x0f, 0x17,
+  0x86, 0x59, 0xd4, 0xe8, 0xe9, 0x07, 0x50, 0xd9, 0x2b, 0x79, 0x0f, 0x43, 0xa8, 0x4d, 0xf9, 0x14,
+  0x3a, 0x25, 0xe9, 0xba, 0x62, 0x2b, 0xce, 0x10, 0xa8, 0x0c, 0xc6, 0x21, 0xcc, 0xe6, 0x07, 0xb7,
+  0x7f, 0x59, 0xb0, 0xe8, 0xe1, 0x8e, 0xf9, 0x8c, 0x73, 0xaa, 0xfe, 0xc6, 0x07, 0xa6, 0x5e, 0xc0,
+  0xa2, 0xba, 0x74, 0x54, 0x6f, 0x4c, 0x0c, 0x04, 0x94, 0x37, 0x25, 0x1c, 0x95, 0x8d, 0x79, 0xfc,
+  0x99, 0x28, 0xd0, 0x8a, 0x4d, 0x15, 0x17, 0x75, 0x4c, 0xea, 0xa9, 0x78, 0xe2, 0x6c, 0x9e, 0x18,
+  0x92, 0xc7, 0x35, 0xeb, 0xca, 0xf2, 0x9e, 0xb4, 0x1c, 0xbb, 0xff, 0xb8, 0xba, 0x70, 0xd6, 0x02,
+  0x60, 0x5f, 0xa7, 0x82, 0x67, 0xe9, 0x36, 0xaf, 0x40, 0x0a, 0x2a, 0x70, 0x67, 0x1f, 0xd3, 0x65,
+  0x1e, 0x1b, 0xeb, 0x88, 0x39, 0x2d, 0x4e, 0x24, 0x04, 0xab, 0x0a, 0x86, 0xdf, 0x65, 0x02, 0x33,
+  0x92, 0x12, 0x9b, 0x65, 0x61, 0x26, 0xe4, 0xd7, 0x5f, 0x4b, 0x12, 0x15, 0x6c, 0x8e, 0x93, 0x27,
+  0x99, 0x2c, 0xcc, 0x52, 0x67, 0xf3, 0xeb, 0x18, 0xf6, 0x8c, 0x58, 0xb2, 0x88, 0x82, 0x62, 0x22,
+  0x4e, 0x34, 0x3e, 0xab, 0xa4, 0xec, 0x17, 0xd9, 0x9a, 0x0f, 0x5e, 0x66, 0x84, 0x7a, 0x96, 0xb6,
+  0xb9, 0xea, 0x2a, 0xf6, 0x04, 0x6d, 0x89, 0xd4, 0xd1, 0xe7, 0x5c, 0x7c, 0xfa, 0x58, 0x37, 0xd3,
+  0xb5, 0xa2, 0x0b, 0x2a, 0xad, 0x65, 0xa0, 0xc5, 0x32, 0x00, 0xfa, 0x27, 0x19, 0x40, 0xf4, 0xea,
+  0x37, 0x00, 0x7c, 0x38, 0xf9, 0xe1, 0x72, 0x90, 0x2f, 0x17, 0x77, 0xc6, 0x1b, 0x96, 0xa3, 0x5b,
+  0xfb, 0xf9, 0xff, 0x4f, 0x6e, 0x39, 0x55, 0xc8, 0xd5, 0x74, 0x1c, 0x4b, 0x96, 0x7c, 0x3c, 0xc3,
+  0x26, 0xda, 0xdd, 0x75, 0x85, 0x3d, 0xaa, 0x02, 0x8c, 0x4a, 0x66, 0x24, 0x99, 0x58, 0x95, 0xf9,
+  0xdb, 0x1e, 0x64, 0xa8, 0xd1, 0xf7, 0x83, 0xab, 0x4b, 0x80, 0xfe, 0xbc, 0x26, 0x49, 0x15, 0x55,
+  0xa8, 0x1e, 0xb6, 0x21, 0xa9, 0x4d, 0xcb, 0x40, 0x74, 0x47, 0x7a, 0x92, 0x8b, 0x2e, 0xf4, 0xe8,
+  0x00, 0x1c, 0x51, 0x18, 0x4c, 0xb2, 0x90, 0x88, 0x45, 0x25, 0xff, 0x2e, 0xe5, 0x17, 0x85, 0x42,
+  0xd4, 0x8e, 0x50, 0xa1, 0xd2, 0xd0, 0x2b, 0xb9, 0x62, 0x35, 0xce, 0xa6, 0x46, 0x5a, 0x23, 0xfc,
+  0xe0, 0x90, 0x22, 0x14, 0x25, 0x31, 0xb6, 0x5d, 0x45, 0x2d, 0x9e, 0x6a, 0xbb, 0x46, 0x31, 0x21,
+  0x4f, 0xd9, 0x97, 0xba, 0xa3, 0x4a, 0x82, 0x96, 0xff, 0x7d, 0xae, 0x6e, 0x2a, 0x66, 0xfe, 0xfe,
+  0x0a, 0x1f, 0x70, 0xe2, 0x4f, 0x89, 0xf9, 0xe1, 0x24, 0xbb, 0x9e, 0xe7, 0x4b, 0x72, 0x6f, 0x0b,
+  0x35, 0x7b, 0x1f, 0x2f, 0x06, 0x2f, 0x21, 0xbe, 0x30, 0x10, 0x82, 0x51, 0x3f, 0xbf, 0xbe, 0x4a,
+  0x35, 0xfd, 0x12, 0x4a, 0x17, 0xe6, 0xd6, 0x1b, 0x04, 0xa4, 0x76, 0x78, 0xa4, 0xba, 0x76, 0x12,
+  0x73, 0x76, 0xf5, 0xfd, 0x0d, 0xae, 0xbb, 0x9e, 0xe7, 0x23, 0x75, 0xe9, 0x79, 0x31, 0x04, 0xc6,
+  0xc7, 0xd7, 0x7e, 0xb8, 0xbd, 0x24, 0x00, 0xbc, 0xf4, 0x02, 0x37, 0x5c, 0xda, 0xc0, 0x0b, 0x8a,
+  0xc9, 0x8f, 0x1d, 0x46, 0x1e, 0xb0, 0x32, 0xb7, 0x29, 0xb1, 0xfe, 0xea, 0xfa, 0xbc, 0xff, 0x73,
+  0xff, 0xd3, 0xf9, 0xcd, 0xf5, 0xc5, 0xa7, 0x01, 0x0e, 0x83, 0x9a, 0xbc, 0x7d, 0x4c, 0xb1, 0xac,
+  0x9a, 0xc8, 0xb6, 0xcf, 0xea, 0x0e, 0x68, 0x63, 0x1a, 0x44, 0xbd, 0x09, 0xf4, 0x34, 0xc3, 0xa0,
+  0xae, 0xae, 0xe4, 0xc1, 0x5f, 0x5e, 0x9a, 0xaf, 0x1c, 0x8f, 0xb5, 0xa5, 0xe7, 0x17, 0x77, 0x83,
+  0x0d, 0x64, 0xb8, 0xc0, 0x43, 0x1a, 0x8c, 0x74, 0x52, 0xee, 0x06, 0x27, 0x03, 0x6d, 0x03, 0x19,
+  0x8a, 0xfb, 0x11, 0x0d, 0x44, 0xb4, 0x26, 0x24, 0x18, 0x15, 0x84, 0xbb, 0xd5, 0x58, 0x83, 0x19,
+  0x5c, 0x5c, 0xf5, 0x6f, 0xd7, 0xc3, 0xf0, 0xa2, 0x42, 0x87, 0x39, 0xbb, 0x3a, 0x57, 0xce, 0xa3,
+  0xc1, 0x8c, 0x66, 0xae, 0x06, 0xc0, 0xd3, 0x36, 0x9d, 0x59, 0x2c, 0x06, 0xc5, 0x6f, 0x46, 0x98,
+  0xdf, 0xd5, 0x73, 0xc1, 0xd1, 0xf8, 0x21, 0x18, 0x91, 0xf1, 0x22, 0xe0, 0x37, 0xf1, 0xe0, 0xd7,
+  0x03, 0xf7, 0x96, 0x81, 0x23, 0x8e, 0x13, 0x88, 0xa1, 0x2e, 0x6f, 0xac, 0x36, 0x48, 0x38, 0x4f,
+  0x62, 0x40, 0xf1, 0xb8, 0x52, 0xdc, 0x42, 0xf4, 0xa0, 0x04, 0x3a, 0xb1, 0x33, 0x3a, 0x16, 0xba,
+  0xa4, 0x5e, 0x42, 0xc6, 0x0c, 0x92, 0x65, 0x43, 0xa2, 0xf3, 0xed, 0x63, 0x86, 0x71, 0xf5, 0x59,
+  0xe0, 0x34, 0xf7, 0x4b, 0xf0, 0x89, 0x08, 0x1a, 0x02, 0x45, 0xc4, 0x1d, 0xba, 0xa1, 0x2c, 0x43,
+  0xdf, 0xed, 0xd2, 0x84, 0xc2, 0xa2, 0x60, 0xe1, 0xfb, 0xf2, 0x14, 0xa7, 0x28, 0x9b, 0xfc, 0xcb,
+  0xdd, 0xf5, 0x27, 0x7b, 0x8e, 0x0f, 0x87, 0x1a, 0x88, 0xc4, 0xdc, 0x27, 0x2b, 0x02, 0xba, 0x8b,
+  0xcd, 0xf0, 0x95, 0x1c, 0x18, 0x31, 0x9a, 0x70, 0x10, 0xf4, 0xa7, 0x50, 0x56, 0x84, 0x63, 0x8e,
+  0xc1, 0x8e, 0xd9, 0x2f, 0xe4, 0x35, 0x7a, 0xd7, 0x60, 0x31, 0x1b, 0xb2, 0xa8, 0xae, 0x46, 0x75,
+  0x01, 0x98, 0x19, 0x97, 0x99, 0x9b, 0x99, 0x16, 0x81, 0x3e, 0x67, 0xf9, 0xfd, 0xdb, 0x47, 0x9c,
+  0x58, 0x7d, 0xde, 0x57, 0x70, 0x88, 0x08, 0xc6, 0xcf, 0x2c, 0x4f, 0xc8, 0xf4, 0x81, 0x93, 0x38,
+  0x0b, 0x67, 0x90, 0xb6, 0xb8, 0x31, 0x54, 0xad, 0x8c, 0x80, 0x68, 0x16, 0x90, 0xaf, 0x90, 0x78,
+  0x1a, 0x2e, 0xc1, 0x33, 0x33, 0xc0, 0x11, 0x2f, 0xfc, 0x84, 0x84, 0xa0, 0xd0, 0xfc, 0xfb, 0xa8,
+  0x48, 0xf2, 0xe8, 0x7c, 0xee, 0x7b, 0xe0, 0xb9, 0xbc, 0xe4, 0xd5, 0xb7, 0xd3, 0x2d, 0x98, 0xc1,
+  0xbf, 0xae, 0x88, 0x21, 0xb6, 0x27, 0x6f, 0xb2, 0x71, 0xf6, 0xcb, 0xca, 0x54, 0x0e, 0x25, 0x04,
+  0x87, 0x3f, 0x3e, 0x84, 0x51, 0x4a, 0xb9, 0x91, 0xad, 0x55, 0x04, 0xf9, 0x5b, 0x08, 0x51, 0xb6,
+  0x4c, 0xb9, 0x28, 0xcd, 0x4b, 0x89, 0x4b, 0x2a, 0x73, 0x83, 0x45, 0x91, 0x59, 0x52, 0xd7, 0x10,
+  0xa2, 0x21, 0x4c, 0x40, 0xb2, 0x81, 0xd3, 0x2f, 0x26, 0xae, 0x9e, 0x11, 0xd7, 0x47, 0x1c, 0x9b,
+  0xd2, 0x25, 0xcd, 0xca, 0x34, 0xf6, 0x00, 0x67, 0x1a, 0x04, 0x0d, 0x3f, 0x5c, 0x24, 0x57, 0x68,
+  0x68, 0x5b, 0x8e, 0xe3, 0xc8, 0xd4, 0x0a, 0xd3, 0x70, 0xa1, 0xb8, 0xc7, 0xbb, 0x19, 0x58, 0x70,
+  0x0e, 0xbe, 0xc8, 0x0e, 0xc2, 0x25, 0x78, 0xfc, 0xef, 0x0a, 0xc8, 0x82, 0x80, 0xe5, 0xd4, 0x83,
+  0xca, 0xc0, 0x90, 0x96, 0x1d, 0xe4, 0xe0, 0x2a, 0x1b, 0x74, 0x2b, 0xde, 0x60, 0xc7, 0xb2, 0x17,
+  0x5a, 0x1d, 0x03, 0xd1, 0x87, 0x6f, 0x1f, 0x51, 0x01, 0xc0, 0x98, 0x1f, 0x81, 0xcd, 0x50, 0x8d,
+  0x43, 0xee, 0x18, 0x84, 0x16, 0xb8, 0x99, 0x88, 0xd5, 0xc9, 0xca, 0xdc, 0x2f, 0x19, 0x4c, 0x64,
+  0x87, 0x5f, 0xc8, 0xfb, 0xf7, 0xc4, 0xc8, 0xec, 0xfb, 0xef, 0x71, 0x18, 0x18, 0xa6, 0x69, 0xbb,
+  0x21, 0x12, 0x96, 0xd9, 0x43, 0xb4, 0x60, 0x8a, 0x3d, 0x54, 0x19, 0xae, 0xc0, 0x10, 0xb0, 0x25,
+  0xb9, 0x89, 0xc2, 0x99, 0x07, 0x66, 0x0e, 0x96, 0x80, 0xf1, 0x0f, 0xdc, 0xdb, 0x40, 0x70, 0x04,
+  0x47, 0x1a, 0x78, 0x87, 0x63, 0x9a, 0x65, 0xd9, 0xe4, 0x7a, 0xa3, 0x14, 0x23, 0x2b, 0x35, 0xa0,
+  0x15, 0x3d, 0x85, 0x4d, 0xf1, 0xb3, 0x58, 0xa5, 0x07, 0xd0, 0xbc, 0x21, 0x42, 0x9e, 0x82, 0xe7,
+  0xab, 0x4a, 0xf1, 0x37, 0x09, 0xb0, 0xc0, 0x17, 0x1e, 0x7f, 0x2d, 0x38, 0x2e, 0xa9, 0x80, 0xe4,
+  0x25, 0xff, 0x66, 0x48, 0xbe, 0xa4, 0x02, 0x54, 0x3c, 0xd8, 0xb8, 0x11, 0x94, 0x2f, 0x29, 0x81,
+  0x66, 0xa5, 0xf2, 0x46, 0xd0, 0x7c, 0xd5, 0x3a, 0xf0, 0xd3, 0x67, 0x81, 0x9f, 0x22, 0xf8, 0xab,
+  0xdc, 0x4b, 0x5e, 0xd2, 0xd9, 0x3c, 0x56, 0xd0, 0x61, 0x4b, 0x17, 0xa3, 0x96, 0x24, 0x70, 0xb7,
+  0xa7, 0x64, 0x55, 0x3a, 0xea, 0xac, 0x1b, 0x5e, 0x97, 0x9e, 0x2f, 0x10, 0x6d, 0xc8, 0xde, 0x13,
+  0x40, 0x62, 0x95, 0x0c, 0xc7, 0xcb, 0xa9, 0xde, 0x53, 0x9b, 0x89, 0xa2, 0x4b, 0x02, 0xe3, 0xf1,
+  0xff, 0x49, 0x30, 0xbe, 0xaa, 0x00, 0x5b, 0xa9, 0x7c, 0xc4, 0xee, 0xe4, 0xcb, 0x0e, 0x9e, 0x35,
+  0x76, 0x5f, 0x74, 0x70, 0xa9, 0x79, 0xfb, 0xa2, 0x83, 0x17, 0x0d, 0xda, 0x17, 0x1d, 0xbc, 0xe8,
+  0xb9, 0x2a, 0x07, 0x7f, 0x55, 0xa4, 0x05, 0x5e, 0x9c, 0x16, 0xcc, 0x79, 0x87, 0xa1, 0x50, 0x8f,
+  0xb4, 0xfa, 0xf8, 0xe1, 0x42, 0xd5, 0x38, 0x31, 0x7a, 0xc8, 0xfd, 0xc8, 0xa6, 0x86, 0x09, 0xa8,
+  0x5d, 0xde, 0xd6, 0x52, 0xf5, 0xee, 0x22, 0xc8, 0xc3, 0x2b, 0xbe, 0x43, 0x82, 0x4d, 0x4e, 0xc3,
+  0xb4, 0x21, 0x12, 0x07, 0x86, 0x9a, 0x8f, 0x0b, 0x0f, 0x98, 0x9a, 0xb4, 0x49, 0x32, 0xe3, 0xae,
+  0x48, 0xed, 0x47, 0xbe, 0x37, 0xfa, 0x02, 0xf9, 0x7c, 0x28, 0x96, 0xee, 0xeb, 0x08, 0xb8, 0xd9,
+  0x9a, 0xb9, 0x8d, 0x6f, 0xc4, 0x20, 0xd6, 0x96, 0x50, 0x70, 0xf3, 0x35, 0x73, 0x5b, 0xdf, 0x88,
+  0x42, 0xac, 0xcd, 0x3d, 0xa4, 0xb9, 0x2e, 0x77, 0x2c, 0x8e, 0xff, 0xe2, 0x2c, 0x51, 0x29, 0x1c,
+  0x30, 0x9c, 0xcc, 0x58, 0x32, 0x0d, 0x41, 0x69, 0xeb, 0x1f, 0xfb, 0x03, 0x3d, 0x94, 0x64, 0x81,
+  0xc4, 0xac, 0x0c, 0x5c, 0x69, 0xfa, 0xa7, 0x06, 0x18, 0x9b, 0x07, 0x90, 0x54, 0x20, 0x98, 0x36,
+  0xea, 0xb1, 0xa9, 0xd0, 0x1c, 0x0e, 0x0f, 0x21, 0x8a, 0xa7, 0x13, 0xf7, 0xd4, 0x5f, 0x30, 0x51,
+  0x64, 0x8b, 0xce, 0x51, 0xbd, 0x3a, 0x4f, 0x93, 0x22, 0x94, 0xc2, 0xe9, 0x22, 0x32, 0x98, 0x52,
+  0x2c, 0xb1, 0xb3, 0x2b, 0xe7, 0xc3, 0x7c, 0xe3, 0x02, 0x2d, 0x26, 0x6d, 0x0f, 0xc8, 0x46, 0xb9,
+  0xd1, 0x95, 0x85, 0x3b, 0x10, 0xc4, 0x39, 0x7f, 0x6d, 0x89, 0xf3, 0x39, 0xa7, 0xfa, 0x38, 0x27,
+  0x0f, 0xdb, 0x37, 0xf8, 0x20, 0xb2, 0xa4, 0xa3, 0x1b, 0x29, 0xa9, 0x90, 0xfb, 0x94, 0x06, 0x13,
+  0xc6, 0x05, 0x8f, 0x9b, 0x88, 0x8b, 0x00, 0x19, 0x1b, 0x24, 0x43, 0x11, 0x77, 0xc0, 0x58, 0x43,
+  0xdd, 0x80, 0x75, 0x78, 0xc1, 0x44, 0xa6, 0x94, 0xcf, 0xf3, 0xe6, 0xd0, 0xba, 0x49, 0x71, 0x3b,
+  0xbb, 0x6e, 0x16, 0x83, 0x77, 0x54, 0x9a, 0xcc, 0x19, 0x9b, 0xab, 0x9b, 0xc2, 0x28, 0xcd, 0xca,
+  0xf2, 0x88, 0x6a, 0x16, 0x21, 0x58, 0xcf, 0x2c, 0xc5, 0x75, 0xc4, 0xdb, 0x47, 0x99, 0x8b, 0x57,
+  0x05, 0x17, 0xf3, 0x6a, 0xbf, 0x2e, 0x67, 0x9b, 0xd5, 0x26, 0x9c, 0xbf, 0x69, 0x00, 0x78, 0x5f,
+  0x97, 0x45, 0xba, 0xc6, 0x6c, 0x73, 0xa8, 0xf5, 0x40, 0xdc, 0xe7, 0xd8, 0x7a, 0x77, 0xd3, 0x24,
+  0x6b, 0x26, 0x72, 0x8d, 0x28, 0xb3, 0x4d, 0xb3, 0x55, 0x59, 0xb8, 0x2a, 0xf7, 0x0a, 0x4b, 0x28,
+  0x2b, 0xec, 0xef, 0xa1, 0xa5, 0xeb, 0xc4, 0xab, 0x22, 0xe1, 0x86, 0x68, 0x2a, 0x21, 0x4d, 0x24,
+  0x6f, 0x59, 0x72, 0xaa, 0x78, 0x90, 0xd5, 0x31, 0x5f, 0x7f, 0x88, 0x15, 0xe7, 0x08, 0x89, 0xbc,
+  0xbd, 0x80, 0x5c, 0x7b, 0x0e, 0x39, 0x66, 0x90, 0xa4, 0xa8, 0x44, 0xd6, 0x9a, 0xbb, 0x99, 0x9b,
+  0xeb, 0x3b, 0xee, 0x67, 0x24, 0xeb, 0x16, 0x3e, 0x3c, 0x42, 0x8f, 0x91, 0xd5, 0xa1, 0xe5, 0xe9,
+  0x04, 0xa7, 0xb3, 0x52, 0xc2, 0x0f, 0x27, 0x46, 0x1d, 0xc9, 0x45, 0xe2, 0x7b, 0x60, 0x42, 0x89,
+  0x0a, 0x21, 0x9c, 0x10, 0x93, 0x41, 0x44, 0xf5, 0x51, 0xff, 0x40, 0x3d, 0x54, 0x84, 0x24, 0x44,
+  0x48, 0xce, 0x78, 0x80, 0x66, 0xe6, 0x33, 0xc4, 0x88, 0xfa, 0x57, 0x52, 0xff, 0x5c, 0x9d, 0xca,
+  0x4d, 0xd2, 0x4c, 0x42, 0x45, 0x99, 0xaf, 0xb4, 0x60, 0x9e, 0xb1, 0x23, 0x57, 0xde, 0xdf, 0xb6,
+  0xa5, 0xda, 0xcb, 0x29, 0xef, 0x09, 0x61, 0xf5, 0x24, 0x20, 0x0c, 0x2b, 0x89, 0x39, 0x99, 0x86,
+  0x3e, 0xd4, 0xbe, 0xbc, 0x55, 0x4a, 0x16, 0x41, 0xe2, 0xf9, 0x84, 0xb7, 0x30, 0xf6, 0x4b, 0xd5,
+  0x6e, 0x10, 0x2f, 0x59, 0x14, 0x93, 0x8e, 0xb3, 0x97, 0xd6, 0x3f, 0xb0, 0xa0, 0x40, 0x98, 0x5d,
+  0x71, 0xc5, 0xe0, 0x65, 0x3c, 0xdf, 0x27, 0x73, 0xc0, 0x12, 0x33, 0xb7, 0xc1, 0xdf, 0x27, 0x4c,
+  0xa6, 0x34, 0x6d, 0x3d, 0x30, 0x2c, 0xb4, 0x17, 0x73, 0x08, 0x66, 0x1c, 0xbf, 0xa8, 0xfc, 0xf8,
+  0x9b, 0x17, 0xeb, 0xf8, 0xc1, 0xc3, 0xa3, 0xc2, 0x8f, 0xf2, 0x81, 0xd5, 0x7e, 0x4c, 0xa5, 0xe6,
+  0x55, 0x31, 0x41, 0xb4, 0x07, 0x33, 0x5f, 0x1b, 0x93, 0x13, 0xf2, 0x9e, 0x9c, 0x4a, 0xed, 0x41,
+  0xd9, 0x5c, 0x2a, 0xbd, 0x72, 0xa9, 0x86, 0x9c, 0xc3, 0x0c, 0x46, 0x47, 0x7e, 0x08, 0x3d, 0x3f,
+  0x79, 0x7e, 0x35, 0xa8, 0x74, 0xd8, 0x9e, 0x5f, 0xfe, 0xbd, 0x16, 0x61, 0x3b, 0x99, 0xe2, 0x7b,
+  0x75, 0x98, 0x72, 0xf5, 0x85, 0xfa, 0x0f, 0x21, 0x51, 0x07, 0x71, 0x80, 0x81, 0xca, 0xe5, 0xc8,
+  0x93, 0x51, 0xbd, 0x6a, 0x21, 0xae, 0x92, 0xdb, 0x38, 0x27, 0x22, 0x7a, 0xa7, 0x4d, 0x1c, 0xf0,
+  0x41, 0x62, 0xd4, 0x4e, 0xc2, 0x0f, 0xde, 0x57, 0xf0, 0x98, 0x2d, 0x13, 0x9d, 0x91, 0x65, 0xd5,
+  0xab, 0x90, 0x0d, 0x35, 0x64, 0xa7, 0x95, 0xc8, 0x4e, 0x9f, 0x42, 0xc6, 0x5d, 0x79, 0x56, 0xf4,
+  0x98, 0x45, 0x95, 0x54, 0xea, 0x75, 0xe4, 0xd7, 0x8b, 0x6f, 0x1f, 0x29, 0xa4, 0x14, 0xb3, 0xcf,
+  0xeb, 0xf1, 0x9c, 0x16, 0x78, 0x4e, 0xd7, 0xe0, 0x39, 0x45, 0x3c, 0xc3, 0x12, 0x9e, 0xa2, 0x25,
+  0x52, 0xd5, 0xd2, 0x7a, 0x19, 0x9d, 0x96, 0xf5, 0x9b, 0x49, 0xd4, 0x50, 0x48, 0x39, 0x55, 0x31,
+  0x8c, 0x5a, 0xab, 0xe4, 0x09, 0x2c, 0xb9, 0xc0, 0x87, 0xe1, 0xc0, 0x95, 0x1b, 0x38, 0xd7, 0x20,
+  0x5d, 0x28, 0xf2, 0xab, 0x2c, 0xe8, 0x32, 0x0c, 0x26, 0x16, 0x57, 0x7a, 0x4a, 0xee, 0xc1, 0x3b,
+  0x80, 0xa9, 0x80, 0x9f, 0x4d, 0xad, 0x3a, 0x0a, 0x17, 0x09, 0x28, 0x6d, 0xe6, 0x38, 0x68, 0xda,
+  0x45, 0x5b, 0x82, 0x63, 0x27, 0x71, 0x88, 0x16, 0x0a, 0x46, 0x44, 0x44, 0x42, 0xe4, 0x16, 0x38,
+  0x63, 0x2f, 0xeb, 0xb5, 0xf9, 0x14, 0x94, 0x24, 0x45, 0x4b, 0x96, 0xe0, 0x2d, 0xe8, 0x12, 0xf2,
+  0x26, 0x98, 0x89, 0x96, 0x5e, 0x5c, 0x6a, 0xc7, 0x09, 0x47, 0x26, 0x7a, 0x76, 0xdc, 0x2d, 0x14,
+  0x28, 0x85, 0x5f, 0x03, 0xd5, 0x76, 0x43, 0x30, 0x73, 0x23, 0x2c, 0xbc, 0xd9, 0x96, 0xd3, 0x21,
+  0x74, 0x0c, 0x67, 0xe5, 0x80, 0xa8, 0xfe, 0xa6, 0xad, 0xdb, 0xfe, 0x52, 0xc4, 0x95, 0xa2, 0x5d,
+  0x1b, 0x9c, 0x83, 0x5e, 0x36, 0xf0, 0xd1, 0xe2, 0xab, 0x58, 0x16, 0x32, 0x16, 0x49, 0x19, 0xb9,
+  0x7a, 0xfb, 0xf4, 0x37, 0xf9, 0x87, 0x45, 0x84, 0x50, 0x39, 0xea, 0x43, 0x81, 0x1c, 0x0c, 0x24,
+  0x23, 0x0a, 0xec, 0xe2, 0xb3, 0xd4, 0xff, 0x3d, 0xe6, 0x3c, 0x84, 0xf8, 0x9c, 0x82, 0xac, 0xde,
+  0xe3, 0xc9, 0x0e, 0xdb, 0x0e, 0xfc, 0xf9, 0xbc, 0xff, 0x0c, 0x07, 0x04, 0x1b, 0xbe, 0xa4, 0xeb,
+  0x94, 0x0a, 0x1c, 0x09, 0x6b, 0xab, 0xad, 0xb5, 0x17, 0x3a, 0x99, 0xf4, 0x82, 0x50, 0xf2, 0x09,
+  0xf2, 0xa1, 0x8b, 0x5e, 0x71, 0xc1, 0x65, 0x79, 0x91, 0x8e, 0x4b, 0x08, 0x8a, 0xb7, 0x47, 0xb5,
+  0x7d, 0x56, 0xc5, 0xe5, 0x5f, 0x4e, 0x3d, 0x76, 0xa3, 0x41, 0x1d, 0xca, 0xd4, 0xbf, 0xc8, 0x9f,
+  0xae, 0x9e, 0xe5, 0x0a, 0xd6, 0x69, 0xc9, 0x4b, 0x3b, 0x6f, 0x4a, 0xeb, 0x4d, 0xdd, 0x5c, 0x5a,
+  0x2d, 0x6c, 0x58, 0xa8, 0xeb, 0xfe, 0xd3, 0x0e, 0xa0, 0x1c, 0x22, 0xd3, 0xea, 0x9e, 0xdf, 0xd1,
+  0x6c, 0x88, 0x8f, 0x6a, 0x55, 0x22, 0x1d, 0x59, 0x58, 0x90, 0x7a, 0x03, 0xd4, 0x48, 0xf5, 0xe1,
+  0xa8, 0xa2, 0x7e, 0x8d, 0xb5, 0xc0, 0x90, 0x6f, 0x4c, 0xea, 0xf8, 0xd8, 0x67, 0x30, 0xc9, 0x83,
+  0x83, 0x98, 0xe9, 0x95, 0x2e, 0xc0, 0xf5, 0x04, 0x3f, 0xbf, 0x4d, 0x97, 0x93, 0xfb, 0xe2, 0x8a,
+  0x3d, 0x2e, 0x55, 0xc0, 0x15, 0x45, 0xbc, 0x78, 0x66, 0x07, 0x48, 0x13, 0xba, 0x92, 0x5e, 0x2f,
+  0xef, 0xab, 0xb7, 0x09, 0xe2, 0x82, 0x89, 0x80, 0x53, 0x73, 0x31, 0xe5, 0x8c, 0xd9, 0x9c, 0x46,
+  0xb0, 0x8b, 0xff, 0x50, 0xf0, 0x5d, 0xf4, 0x4c, 0xd7, 0x73, 0x5b, 0xd4, 0x6f, 0x64, 0xe6, 0xa1,
+  0xb6, 0x29, 0xec, 0x86, 0x25, 0xf7, 0x98, 0x62, 0x09, 0xe7, 0x38, 0x9b, 0xd7, 0x63, 0x32, 0xa7,
+  0x09, 0x78, 0x2f, 0xfe, 0x86, 0x6c, 0x93, 0xb4, 0x40, 0x0e, 0x8c, 0xba, 0x0f, 0x0d, 0x7c, 0x9e,
+  0xec, 0xc7, 0x39, 0x8b, 0xbc, 0xd0, 0xfd, 0x79, 0x16, 0xa3, 0xcb, 0x82, 0x5f, 0x3f, 0x91, 0x31,
+  0x78, 0x54, 0x74, 0xba, 0xb6, 0x94, 0x08, 0x8a, 0x41, 0xc4, 0x4a, 0x03, 0x0f, 0x2a, 0x32, 0x20,
+  0x1a, 0x1c, 0x2c, 0x23, 0x63, 0x50, 0x3e, 0x91, 0xa3, 0xd1, 0x19, 0x23, 0xc2, 0xf2, 0xc4, 0xce,
+  0x97, 0xfd, 0xf3, 0x33, 0x12, 0x2d, 0x82, 0x18, 0xd0, 0xda, 0x15, 0x75, 0x05, 0xb6, 0x0a, 0x0d,
+  0x06, 0x1a, 0x77, 0x5f, 0xca, 0x62, 0x59, 0x45, 0xfe, 0x2a, 0x44, 0xfe, 0x85, 0x3d, 0x64, 0xb7,
+  0x4a, 0x42, 0xc4, 0xde, 0xf8, 0xc1, 0xb8, 0x27, 0xc7, 0xc7, 0xc4, 0xd1, 0xda, 0x2b, 0x50, 0x6a,
+  0xa2, 0xe8, 0x51, 0x22, 0xe9, 0xe1, 0xb9, 0x66, 0x00, 0x82, 0x1c, 0x37, 0x1e, 0xcc, 0x67, 0xf4,
+  0x9e, 0x41, 0x58, 0x02, 0x42, 0x03, 0x8c, 0x33, 0xe2, 0x98, 0xd4, 0x0f, 0xf3, 0x54, 0x13, 0x9f,
+  0x00, 0x28, 0xa3, 0x42, 0x44, 0xf2, 0x33, 0x02, 0xd8, 0x28, 0x3b, 0xe1, 0x9c, 0x81, 0xe3, 0xc5,
+  0xc7, 0xb6, 0x61, 0xda, 0xe3, 0x30, 0xea, 0x83, 0x67, 0x34, 0xb8, 0xf6, 0x52, 0xa8, 0x3b, 0xc0,
+  0xd9, 0x82, 0xfd, 0x98, 0x0a, 0x18, 0xbf, 0xaf, 0xc7, 0xba, 0xdf, 0x16, 0xcf, 0xfe, 0x19, 0xf5,
+  0x30, 0xa8, 0xe3, 0x9b, 0x41, 0x11, 0x7d, 0xb0, 0xbd, 0x98, 0xff, 0x36, 0x80, 0x43, 0xbf, 0xfe,
+  0x4a, 0x5e, 0xbf, 0xbe, 0xd7, 0xce, 0x58, 0x5a, 0xf5, 0xfe, 0x3d, 0xb9, 0xff, 0xd1, 0xf9, 0x89,
+  0x1c, 0x81, 0x9c, 0xe1, 0x33, 0xe0, 0x4f, 0xa5, 0xa5, 0x7a, 0x96, 0x62, 0xdc, 0xf8, 0x51, 0x71,
+  0x2a, 0x8f, 0xc5, 0xeb, 0x1d, 0x2d, 0x50, 0x87, 0xf1, 0x58, 0xbc, 0xfb, 0x01, 0xca, 0xb8, 0x6e,
+  0x99, 0x63, 0xb7, 0x8b, 0x85, 0x57, 0x34, 0x99, 0xe2, 0x9b, 0xdc, 0x06, 0x00, 0xdf, 0xff, 0xd8,
+  0xfa, 0x09, 0x74, 0x0d, 0xc9, 0x31, 0x9f, 0x0b, 0xdf, 0x52, 0x5c, 0xd3, 0x4f, 0x18, 0x5b, 0xdc,
+  0x45, 0x44, 0xc5, 0xab, 0x0d, 0x88, 0xa9, 0x01, 0xd1, 0x99, 0x89, 0x81, 0xb8, 0x47, 0x2e, 0x82,
+  0x31, 0x76, 0xbb, 0x40, 0x8f, 0x19, 0x8d, 0xf9, 0x8b, 0x59, 0x60, 0xf7, 0x6c, 0x6e, 0x41, 0x80,
+  0x53, 0x43, 0xd0, 0x6a, 0x7d, 0x7d, 0x5b, 0xd1, 0x09, 0x29, 0x79, 0x24, 0xed, 0x82, 0xb9, 0xda,
+  0x25, 0x65, 0x1a, 0x8d, 0x9d, 0x61, 0x7c, 0x19, 0xb5, 0xc1, 0x5b, 0xbd, 0xe8, 0x7c, 0x70, 0xe4,
+  0x18, 0x87, 0x14, 0xef, 0xa1, 0xac, 0x17, 0xfd, 0xdb, 0x86, 0xbc, 0x5e, 0x0c, 0xad, 0x07, 0xe1,
+  0xad, 0xdb, 0x86, 0xb2, 0x05, 0x1f, 0xaa, 0x84, 0xc0, 0xae, 0xad, 0x4a, 0x14, 0xe6, 0x84, 0xeb,
+  0x89, 0xe2, 0xeb, 0x15, 0xa2, 0xc4, 0xfa, 0x0d, 0x44, 0x71, 0x10, 0x85, 0x28, 0x01, 0xa2, 0x13,
+  0xf5, 0xa4, 0x5f, 0x1b, 0x08, 0xd7, 0x68, 0x80, 0x30, 0xbe, 0x10, 0xf1, 0x4f, 0xfe, 0x80, 0xb7,
+  0x44, 0xdb, 0x84, 0xc2, 0x5c, 0xbc, 0x23, 0xc8, 0x5f, 0x1d, 0x34, 0x37, 0x84, 0x18, 0xb5, 0x7b,
+  0x55, 0x12, 0xa8, 0x76, 0xfb, 0xbf, 0x29, 0xc6, 0x20, 0x67, 0xf9, 0x6d, 0xa0, 0x91, 0x33, 0x1a,
+  0x2d, 0x4b, 0x0e, 0x3b, 0xa9, 0xc4, 0xf1, 0x1f, 0xc8, 0x81, 0xed, 0xc0, 0x83, 0xaa, 0x59, 0x88,
+  0xf6, 0x80, 0x59, 0x35, 0x88, 0xf6, 0x58, 0x99, 0x53, 0xbe, 0x92, 0x47, 0x6e, 0x4a, 0x84, 0xe0,
+  0x57, 0x9d, 0x10, 0x1c, 0x7b, 0x21, 0x21, 0x25, 0x90, 0x32, 0x21, 0x7a, 0xcf, 0x17, 0x49, 0xe7,
+  0x62, 0xd0, 0xb3, 0x95, 0x62, 0x46, 0xad, 0x33, 0xb4, 0x3c, 0x29, 0xe5, 0x28, 0xba, 0xa8, 0x63,
+  0x81, 0x0e, 0xbe, 0x35, 0x45, 0x9a, 0x22, 0xd7, 0x70, 0xdf, 0x81, 0x35, 0xf3, 0x1e, 0xd5, 0xbf,
+  0xff, 0xf9, 0xaf, 0xfa, 0xba, 0xf4, 0x85, 0xdf, 0x10, 0xa3, 0xe6, 0x55, 0x52, 0x54, 0xcc, 0x6c,
+  0xa4, 0x28, 0x65, 0x6d, 0x4a, 0x51, 0xfa, 0xed, 0xdb, 0x28, 0x5a, 0x35, 0x78, 0x6a, 0xab, 0x3d,
+  0x69, 0xc4, 0xbf, 0x1f, 0x34, 0xb3, 0xc7, 0x4c, 0x0f, 0x9a, 0xe2, 0xc5, 0x9c, 0x83, 0xa6, 0xf8,
+  0xd7, 0xb5, 0xfe, 0x03, 0x13, 0x13, 0xb3, 0x7c, 0x6e, 0x4b, 0x00, 0x00,
+};
+
+// script.js: 8430 bytes, 2651 gzipped
+constexpr uint8_t asset_script_js[] PROGMEM = {
+  0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0xad, 0x59, 0xef, 0x6e, 0xdb, 0x38,
+  0x12, 0xff, 0x9e, 0xa7, 0x98, 0x60, 0x8b, 0x48, 0xc2, 0x3a, 0x4a, 0xd2, 0xee, 0x7d, 0xb8, 0xe4,
+  0xd2, 0x20, 0x7f, 0xdc, 0x3d, 0x1f, 0x9c, 0x26, 0x48, 0xdc, 0xfb, 0x52, 0x14, 0x1b, 0xc6, 0xa2,
+  0x6d, 0x6d, 0x65, 0x51, 0xa5, 0xe8, 0x78, 0x8d, 0xd4, 0xc0, 0x3e, 0xc4, 0x3d, 0xe1, 0x3d, 0xc9,
+  0xcd, 0x90, 0x12, 0x45, 0xca, 0x8e, 0x93, 0x74, 0xaf, 0xc0, 0x6e, 0x6c, 0x72, 0x66, 0x38, 0x9c,
+  0x3f, 0xbf, 0x99, 0xa1, 0xd3, 0x69, 0x21, 0xa4, 0x82, 0x7f, 0x73, 0xa9, 0xd2, 0x21, 0xcb, 0xfa,
+  0xe9, 0x48, 0x9d, 0xc9, 0x34, 0x19, 0xf3, 0x73, 0x91, 0x2b, 0x29, 0xb2, 0x8c, 0x4b, 0x18, 0x49,
+  0x31, 0x85, 0x20, 0xde, 0xbb, 0x6f, 0x6d, 0xc4, 0xbf, 0x97, 0xc1, 0xd1, 0xd6, 0x56, 0x22, 0x86,
+  0xb3, 0x29, 0xcf, 0x55, 0xcc, 0x92, 0xa4, 0xfb, 0x80, 0x1f, 0xfa, 0x69, 0xa9, 0x78, 0xce, 0x65,
+  0x18, 0x5c, 0x5c, 0x5d, 0x12, 0x39, 0xad, 0x09, 0x96, 0xf0, 0x24, 0xe8, 0x40, 0x18, 0xc1, 0xf1,
+  0x7b, 0x78, 0xdc, 0x02, 0x18, 0x8a, 0xbc, 0x54, 0x50, 0x2a, 0xa6, 0x66, 0x65, 0x37, 0x83, 0x63,
+  0xb0, 0x82, 0xc6, 0x5c, 0x75, 0x33, 0x4e, 0x1f, 0xcf, 0x16, 0xbd, 0x24, 0x0c, 0x32, 0x9e, 0xdc,
+  0x6a, 0xb2, 0x20, 0x3a, 0xb2, 0x8c, 0xf7, 0xac, 0xe4, 0x9f, 0x6e, 0xfa, 0x80, 0x8c, 0xf3, 0x34,
+  0x4f, 0xc4, 0x3c, 0xce, 0xc4, 0x90, 0xa9, 0x54, 0xe4, 0xb1, 0x90, 0xe9, 0x38, 0xcd, 0x51, 0xb5,
+  0x9a, 0xf6, 0xf2, 0xea, 0xa2, 0xfb, 0x5b, 0xf7, 0xe3, 0xc5, 0xf5, 0x55, 0xef, 0xe3, 0x00, 0x80,
+  0x78, 0xee, 0xde, 0x3c, 0x56, 0x12, 0x96, 0x7b, 0x53, 0x91, 0xf0, 0xbb, 0x46, 0xf2, 0xd5, 0x75,
+  0xf7, 0x63, 0x8b, 0x3a, 0xd8, 0x43, 0x1d, 0xf6, 0x44, 0x1e, 0x34, 0x54, 0xe7, 0xfd, 0xab, 0x5b,
+  0x4f, 0xa8, 0xa5, 0x1a, 0x8d, 0x1c, 0xb2, 0x8b, 0xde, 0xed, 0x60, 0xc3, 0xd1, 0x09, 0xda, 0x8a,
+  0xe5, 0x43, 0xf7, 0xf8, 0xdb, 0xc1, 0xe9, 0xa0, 0x25, 0xd8, 0xe5, 0x20, 0x83, 0xb9, 0xe4, 0xfd,
+  0xde, 0xaf, 0xff, 0x1c, 0xdc, 0x3a, 0xf4, 0x3e, 0x79, 0x96, 0x8e, 0x27, 0xaa, 0x74, 0xe8, 0x07,
+  0xbd, 0xcb, 0xee, 0xcd, 0xd3, 0xf4, 0x2a, 0x9d, 0x72, 0xe9, 0xd2, 0x9f, 0x5f, 0x5e, 0x78, 0xfa,
+  0xb7, 0xe8, 0x87, 0xd3, 0xc4, 0x21, 0xbe, 0xe9, 0xde, 0x76, 0x07, 0x6d, 0xa3, 0xf0, 0x52, 0x89,
+  0x62, 0x4f, 0xf2, 0x92, 0xab, 0x40, 0x3b, 0x85, 0x95, 0x8b, 0x7c, 0x08, 0xa3, 0x59, 0x3e, 0x24,
+  0x77, 0x41, 0xc9, 0xf3, 0xe4, 0x86, 0x7f, 0x9b, 0x21, 0x5d, 0x88, 0x1f, 0x0b, 0x91, 0xe6, 0xaa,
+  0x03, 0xa2, 0x50, 0x25, 0xb2, 0x3f, 0x2e, 0x23, 0x1d, 0x2d, 0x00, 0x4a, 0x2e, 0xaa, 0x4f, 0xf5,
+  0x69, 0x12, 0xf7, 0xd9, 0x9c, 0xa5, 0x0a, 0x46, 0x5c, 0x0d, 0x27, 0xa1, 0xa3, 0xd7, 0x9b, 0xc7,
+  0x5a, 0xd2, 0xf2, 0xce, 0xc8, 0xd2, 0xa1, 0xd3, 0xf0, 0x2a, 0xfe, 0x87, 0xb2, 0xec, 0x32, 0xa6,
+  0xaf, 0xa1, 0x25, 0xc9, 0xb8, 0x82, 0x84, 0x29, 0x86, 0x04, 0xf9, 0x2c, 0xcb, 0xea, 0x65, 0xad,
+  0x41, 0xbd, 0xf1, 0xaf, 0xdb, 0xab, 0x8f, 0x71, 0xc1, 0x64, 0xc9, 0x43, 0x62, 0x8e, 0x8e, 0x60,
+  0x09, 0x18, 0x7f, 0xc3, 0x09, 0xaa, 0x5c, 0xd1, 0xa7, 0x23, 0x08, 0xb7, 0x35, 0xf9, 0xf7, 0xef,
+  0xa0, 0x16, 0x05, 0x17, 0x23, 0xcd, 0x1d, 0x97, 0xfc, 0x1b, 0x6c, 0x1f, 0xa3, 0x6d, 0xf2, 0xd9,
+  0xf4, 0x9e, 0xcb, 0x20, 0xb2, 0x17, 0x33, 0x4c, 0x75, 0x52, 0x44, 0x36, 0x3d, 0xb4, 0x82, 0x55,
+  0x2e, 0x91, 0x07, 0x4c, 0x3e, 0x1c, 0xc2, 0x9b, 0x47, 0xda, 0x58, 0xde, 0x1d, 0x59, 0x7e, 0xc9,
+  0xd5, 0x4c, 0xe6, 0xfa, 0x7e, 0xf5, 0x62, 0xad, 0xcf, 0xde, 0x1e, 0x9c, 0x8b, 0xe9, 0x94, 0xe5,
+  0x49, 0x09, 0x4c, 0x72, 0x40, 0x93, 0xcf, 0x78, 0x72, 0x04, 0xe5, 0x44, 0xcc, 0x41, 0x4d, 0x38,
+  0xf2, 0x96, 0xb3, 0x4c, 0x81, 0xc0, 0x80, 0xd4, 0xdf, 0x87, 0x0d, 0x08, 0xb0, 0xa2, 0xc8, 0x52,
+  0x9e, 0x40, 0xaa, 0xb6, 0x7e, 0x4c, 0x4f, 0x73, 0x71, 0xfd, 0x75, 0x09, 0xa1, 0x39, 0x1a, 0x7e,
+  0xaa, 0xd7, 0xf9, 0xb7, 0x65, 0x64, 0x2f, 0x61, 0x9c, 0x42, 0xff, 0xfb, 0x20, 0x64, 0xa5, 0x71,
+  0x58, 0xd3, 0x59, 0x27, 0xfd, 0x15, 0x05, 0xec, 0x51, 0x95, 0xb5, 0x9c, 0x3d, 0xb3, 0x53, 0xfb,
+  0x32, 0xe4, 0x52, 0x46, 0x5e, 0xd8, 0x89, 0x8c, 0xc7, 0xb8, 0x28, 0xa4, 0xde, 0x7a, 0x95, 0x32,
+  0x41, 0xad, 0x4c, 0x97, 0xf8, 0x83, 0xea, 0xa4, 0x2d, 0xfa, 0x6f, 0x35, 0x2b, 0x5a, 0xd7, 0xc7,
+  0x9b, 0x77, 0x80, 0x92, 0x53, 0xcc, 0xd4, 0x25, 0x25, 0xc6, 0xbb, 0xfd, 0xfd, 0xfd, 0x5a, 0x33,
+  0x13, 0xd2, 0x09, 0x67, 0x49, 0x96, 0xe6, 0x1c, 0x37, 0x2f, 0x10, 0x23, 0xe2, 0x5c, 0xcc, 0x11,
+  0x6d, 0x7f, 0x6e, 0xb8, 0xcc, 0x81, 0xf3, 0x49, 0x9a, 0x71, 0x08, 0x1d, 0x92, 0x7f, 0x58, 0xd6,
+  0xe6, 0xaa, 0x6e, 0xb6, 0x6d, 0xc8, 0x37, 0x17, 0x1d, 0x96, 0x27, 0xa8, 0xe4, 0xf1, 0x9b, 0x47,
+  0x72, 0x26, 0x26, 0xdd, 0x23, 0x9a, 0x70, 0x38, 0xe1, 0x87, 0x18, 0xe5, 0x62, 0x17, 0x21, 0x40,
+  0xf2, 0x00, 0x96, 0xd1, 0x91, 0x17, 0xe8, 0x32, 0x16, 0x5f, 0x61, 0x67, 0x07, 0xc2, 0x3a, 0x0f,
+  0x7f, 0x2f, 0x45, 0x1e, 0x46, 0x51, 0x9c, 0x08, 0x52, 0xa6, 0x8e, 0x65, 0x39, 0xe3, 0x36, 0x96,
+  0xdb, 0x49, 0x66, 0x38, 0x73, 0x3e, 0x87, 0x6b, 0xac, 0x53, 0x29, 0xa6, 0x23, 0x46, 0x31, 0xd5,
+  0x18, 0x84, 0x9b, 0x81, 0xb9, 0x39, 0xad, 0x74, 0xe0, 0x00, 0xed, 0x15, 0x35, 0x36, 0xb7, 0xbe,
+  0x1f, 0xb1, 0xac, 0xd4, 0xe2, 0x97, 0x4d, 0xc1, 0xa0, 0x8a, 0x70, 0x3b, 0x4f, 0xe9, 0xa0, 0x0d,
+  0x75, 0xa9, 0xa1, 0x72, 0x0b, 0x13, 0xad, 0xf6, 0xd9, 0x3d, 0xcf, 0xe0, 0x39, 0x5e, 0x4d, 0xe5,
+  0xd5, 0x34, 0x95, 0x5f, 0x15, 0x3c, 0x37, 0x28, 0xfb, 0x24, 0x2b, 0x91, 0xb4, 0xb8, 0xce, 0x33,
+  0x51, 0xf2, 0xcd, 0x5c, 0x9a, 0xa4, 0xc5, 0x76, 0x43, 0x98, 0xbc, 0x99, 0x4d, 0x93, 0x78, 0x6c,
+  0x82, 0xa9, 0x0b, 0xac, 0x5a, 0xa7, 0x1b, 0xd9, 0x2c, 0xd5, 0x3a, 0xd6, 0xb3, 0x17, 0xb1, 0x9e,
+  0x11, 0xeb, 0x96, 0x46, 0xad, 0x3e, 0x9b, 0x16, 0xa5, 0x15, 0x23, 0xb1, 0x97, 0xa0, 0xca, 0x50,
+  0x39, 0x31, 0x39, 0xa4, 0xbf, 0x4f, 0x8a, 0x23, 0xea, 0x5d, 0xa4, 0x0a, 0xa2, 0x8e, 0x66, 0x58,
+  0xf0, 0x2c, 0x13, 0xf3, 0xc3, 0x67, 0x18, 0x0c, 0x55, 0xcd, 0x33, 0x96, 0x9c, 0xe7, 0x87, 0xcf,
+  0x1d, 0xa2, 0xa9, 0x6a, 0x16, 0x5d, 0x47, 0x9f, 0x65, 0xd1, 0x54, 0x86, 0x65, 0xd9, 0xd8, 0xa9,
+  0x9c, 0xa4, 0xc5, 0xcb, 0x2f, 0x48, 0xd4, 0xaf, 0xba, 0xa0, 0x66, 0x78, 0xe5, 0x05, 0x35, 0xcf,
+  0xeb, 0x2e, 0xa8, 0x59, 0xfc, 0x0b, 0x6e, 0x99, 0xd2, 0x9a, 0x96, 0x97, 0x2c, 0x9f, 0x31, 0xea,
+  0xf9, 0xaa, 0xe4, 0x33, 0x6e, 0x36, 0x9d, 0x27, 0x7c, 0xea, 0x35, 0x11, 0x63, 0x56, 0x8e, 0x75,
+  0x7e, 0x6f, 0x6a, 0x52, 0x31, 0x6c, 0xf4, 0xca, 0x8d, 0x10, 0xaa, 0x89, 0x9b, 0x5e, 0xae, 0xcb,
+  0x55, 0x8a, 0x7f, 0x2e, 0x31, 0xdf, 0xc2, 0x28, 0xc6, 0xaa, 0x96, 0x87, 0x4d, 0x0f, 0x6a, 0x50,
+  0xa8, 0x4a, 0xbb, 0x08, 0xea, 0x04, 0x5c, 0xd3, 0xca, 0x0e, 0xb3, 0x74, 0xf8, 0x15, 0xfb, 0x57,
+  0x61, 0x48, 0x8f, 0x5c, 0x66, 0x9d, 0x5a, 0x91, 0xcd, 0xc3, 0x8d, 0xdc, 0x86, 0xd6, 0x63, 0xd7,
+  0x29, 0x16, 0xd9, 0x7c, 0xdc, 0xc8, 0x6e, 0x68, 0x35, 0x5a, 0x45, 0xeb, 0x7a, 0xa9, 0xe6, 0xaa,
+  0x2f, 0xee, 0x9a, 0xbc, 0xe6, 0x98, 0x60, 0x7b, 0xca, 0xd5, 0x44, 0x60, 0xd0, 0x05, 0xbf, 0x76,
+  0x07, 0x2e, 0x64, 0xd7, 0x80, 0x1d, 0xad, 0x14, 0x86, 0xaa, 0x25, 0xf2, 0x41, 0x3c, 0xd6, 0x40,
+  0x5d, 0x19, 0x9b, 0xda, 0x28, 0x17, 0xfb, 0x9b, 0x08, 0x20, 0xde, 0x93, 0xf8, 0x81, 0x65, 0x33,
+  0xf4, 0x33, 0xf5, 0x44, 0x53, 0xbd, 0x13, 0xf8, 0xcd, 0x8b, 0x03, 0xfb, 0xd6, 0x74, 0x0d, 0xfc,
+  0x46, 0x0e, 0x60, 0xc7, 0x58, 0x73, 0x86, 0x5f, 0x39, 0x21, 0x44, 0x7d, 0x8a, 0x11, 0x45, 0x1d,
+  0xcc, 0x82, 0x6c, 0xf3, 0xa9, 0x57, 0x77, 0x7a, 0x46, 0x61, 0xb4, 0xe8, 0x05, 0x7f, 0x48, 0x87,
+  0x5c, 0x1b, 0xce, 0xaa, 0x76, 0x62, 0x55, 0x01, 0xb4, 0x05, 0x9b, 0x29, 0x51, 0x05, 0xd6, 0xc6,
+  0xd3, 0xd7, 0x38, 0x6f, 0xc2, 0xf2, 0x31, 0xd7, 0xde, 0xa3, 0x03, 0x06, 0x62, 0x3c, 0xce, 0x78,
+  0x2d, 0x09, 0x3b, 0x05, 0xa9, 0xd1, 0x8e, 0x86, 0x80, 0x6b, 0x0c, 0xe5, 0x34, 0x1f, 0xd7, 0xda,
+  0xe9, 0x3d, 0x6a, 0x19, 0xd6, 0x6e, 0xf4, 0x75, 0x63, 0xbf, 0x6e, 0x87, 0xaa, 0x9e, 0xf4, 0x36,
+  0xb4, 0xd1, 0x6c, 0x8c, 0x78, 0x86, 0x70, 0xd2, 0xc0, 0x96, 0xa4, 0xa8, 0xa9, 0x61, 0xed, 0x76,
+  0x8a, 0xd8, 0xa8, 0x99, 0x72, 0xad, 0x74, 0xd9, 0x58, 0xe9, 0x14, 0xad, 0x34, 0xc5, 0x21, 0x6c,
+  0x18, 0xd4, 0x2d, 0xd6, 0xfa, 0xfc, 0xc2, 0xb1, 0x87, 0xdd, 0xe3, 0xb0, 0x44, 0x85, 0x60, 0xdb,
+  0x77, 0xd3, 0x13, 0x39, 0x65, 0x39, 0x56, 0x18, 0x4c, 0xe2, 0x63, 0x6b, 0xa8, 0xcc, 0x6a, 0x37,
+  0xd7, 0x84, 0x27, 0xb1, 0x75, 0x65, 0x63, 0x83, 0x56, 0xb6, 0xb8, 0x1e, 0x69, 0x4c, 0xd1, 0xc4,
+  0xe6, 0x6a, 0x54, 0xfd, 0x3f, 0x43, 0xa9, 0xed, 0x17, 0x9f, 0x59, 0x67, 0x44, 0x64, 0x8b, 0x80,
+  0x69, 0x55, 0xea, 0xb6, 0xcb, 0xcb, 0xd9, 0xe5, 0x89, 0xa6, 0x3d, 0xa6, 0x99, 0x67, 0x48, 0x4a,
+  0xdd, 0xf4, 0xb0, 0x6b, 0x2c, 0xb0, 0x83, 0xca, 0x55, 0x25, 0xc6, 0xf4, 0x63, 0x36, 0xb1, 0xaf,
+  0xaf, 0x6e, 0x75, 0x66, 0x57, 0x29, 0x66, 0x50, 0x51, 0x52, 0x9e, 0xd6, 0x93, 0x90, 0xbf, 0xa5,
+  0x68, 0xab, 0x6e, 0x7e, 0x33, 0x31, 0x0e, 0x03, 0x52, 0x91, 0x14, 0x3e, 0xc4, 0xb8, 0x56, 0x0d,
+  0xb5, 0x49, 0x79, 0xee, 0x92, 0x9b, 0x5e, 0x39, 0xf8, 0xc0, 0x52, 0xf2, 0x9e, 0x12, 0xc4, 0xa5,
+  0x0d, 0x8b, 0x9c, 0x3c, 0xda, 0xe0, 0x1a, 0x0a, 0x14, 0x2f, 0x3e, 0xad, 0xdf, 0xeb, 0xc6, 0xd0,
+  0xb7, 0x7c, 0x33, 0x44, 0x7a, 0x03, 0xfc, 0x86, 0x13, 0x74, 0x64, 0xfd, 0xd8, 0x11, 0xfe, 0xf4,
+  0xdf, 0x9c, 0x81, 0x45, 0xe7, 0x34, 0x07, 0x4e, 0xfd, 0x6e, 0x01, 0x13, 0x91, 0xe1, 0xa4, 0xf5,
+  0xe1, 0xf4, 0x53, 0x7f, 0x00, 0xb3, 0x5c, 0xa5, 0x19, 0xe8, 0x21, 0xf8, 0x68, 0x65, 0xb6, 0xca,
+  0xcb, 0x39, 0x0e, 0xdd, 0xf0, 0xcb, 0xfe, 0xdf, 0xab, 0xee, 0x1c, 0x09, 0x8c, 0xb0, 0xfb, 0x99,
+  0x52, 0x04, 0xeb, 0x25, 0xa6, 0x76, 0x9a, 0x65, 0x50, 0xa0, 0x84, 0x92, 0x27, 0x1d, 0xe4, 0x41,
+  0x63, 0x4e, 0x58, 0x35, 0xc8, 0x72, 0x1a, 0xe9, 0x66, 0x05, 0xc2, 0xbf, 0x96, 0x6d, 0xe6, 0x0f,
+  0xa0, 0x8e, 0x7e, 0xdd, 0xbd, 0x75, 0x11, 0xb1, 0xf7, 0x5e, 0xbd, 0x9c, 0x3f, 0xc5, 0xaf, 0x8d,
+  0x1c, 0xf7, 0xc2, 0xc7, 0xf4, 0x0f, 0x6a, 0x10, 0x2b, 0xe1, 0x14, 0x76, 0xe0, 0xcc, 0xac, 0x7a,
+  0xe1, 0xbd, 0x16, 0xea, 0xbc, 0x09, 0xa6, 0xc0, 0x55, 0xaa, 0x23, 0x5a, 0x61, 0xb7, 0x4a, 0xbf,
+  0x6c, 0x1e, 0xf1, 0xde, 0x5a, 0x5e, 0x36, 0x80, 0x6c, 0x9b, 0x82, 0xa6, 0x26, 0x12, 0x47, 0x60,
+  0x6a, 0x32, 0xba, 0x26, 0x5c, 0xef, 0xb1, 0xc5, 0x44, 0x53, 0x63, 0x12, 0xd5, 0x4d, 0xf3, 0xb3,
+  0xf5, 0xae, 0x4d, 0x44, 0x14, 0xee, 0xd0, 0x7f, 0x6a, 0xca, 0x5b, 0x35, 0xf2, 0x23, 0x26, 0x98,
+  0xd5, 0x58, 0x89, 0x0f, 0xe9, 0x1f, 0x3c, 0x09, 0x0f, 0x22, 0x02, 0x87, 0xdd, 0xdd, 0xa0, 0x2d,
+  0xe8, 0xbe, 0x25, 0xe8, 0x6c, 0xad, 0xa0, 0xb3, 0x4d, 0x82, 0x34, 0xa8, 0xd6, 0x2d, 0x79, 0xd4,
+  0xf4, 0xf0, 0x2b, 0xd3, 0x32, 0xc7, 0xa4, 0x95, 0x70, 0x4a, 0x10, 0xcf, 0xb0, 0xe6, 0x4e, 0xef,
+  0xd6, 0xcb, 0x38, 0x6b, 0x64, 0x9c, 0x3d, 0x21, 0xe3, 0x8c, 0x64, 0xdc, 0x7b, 0x32, 0x9a, 0xa1,
+  0xba, 0xfd, 0xe0, 0xf1, 0x3a, 0xdd, 0x76, 0x77, 0xff, 0x92, 0x5a, 0x0e, 0x7b, 0xd5, 0x5c, 0x98,
+  0xaf, 0x14, 0x7d, 0xb6, 0x90, 0x72, 0xd5, 0x43, 0x56, 0x89, 0xf0, 0x19, 0xd2, 0x7a, 0x07, 0xfe,
+  0x86, 0xe3, 0xa3, 0x1b, 0xf5, 0x7d, 0x91, 0x8f, 0x77, 0x75, 0xc0, 0x32, 0x78, 0xc0, 0xec, 0xc5,
+  0x10, 0x47, 0x7c, 0xab, 0x32, 0x4f, 0xe2, 0xd4, 0x89, 0x81, 0x57, 0x27, 0x36, 0xab, 0xde, 0x54,
+  0xe6, 0x08, 0xa6, 0x50, 0x0a, 0xca, 0x26, 0x0c, 0x7e, 0x30, 0x9d, 0x41, 0x62, 0xe4, 0x95, 0x69,
+  0xfd, 0xea, 0x92, 0x31, 0x74, 0x7a, 0x25, 0x12, 0xe6, 0x98, 0xcd, 0x6c, 0x8e, 0xcd, 0x03, 0xee,
+  0xc8, 0x39, 0x8e, 0xb7, 0x6d, 0xf0, 0x30, 0x20, 0x63, 0x5e, 0x6f, 0x74, 0xfa, 0x1a, 0x71, 0x06,
+  0x6f, 0x30, 0x3c, 0x13, 0x81, 0x29, 0x19, 0x8a, 0x06, 0x65, 0xde, 0xed, 0xff, 0x02, 0x6c, 0x84,
+  0x77, 0xd3, 0x4c, 0x14, 0xc2, 0x51, 0xec, 0xe6, 0xe9, 0xdc, 0x60, 0x78, 0xf3, 0x10, 0x97, 0x5f,
+  0x60, 0x7c, 0x75, 0x60, 0xcc, 0x8a, 0xcb, 0xb2, 0x76, 0x1c, 0xb5, 0xf1, 0xb5, 0x8a, 0xee, 0x23,
+  0xd9, 0x0f, 0xe5, 0xf1, 0x4c, 0x12, 0xb5, 0x15, 0x77, 0x6c, 0x04, 0x62, 0x60, 0xd7, 0x4a, 0x60,
+  0x3c, 0xdf, 0x39, 0x2f, 0x7a, 0x27, 0xda, 0x56, 0x58, 0xef, 0x2a, 0x96, 0xe5, 0x0e, 0xdd, 0xe2,
+  0xf8, 0xed, 0x3e, 0xfe, 0xbb, 0x3b, 0x7a, 0x06, 0x24, 0xf0, 0xb0, 0x97, 0xbe, 0x4d, 0x54, 0xce,
+  0x24, 0x85, 0xde, 0x36, 0x8f, 0x2d, 0xaf, 0x00, 0x02, 0x23, 0xc8, 0xcd, 0x5d, 0xf7, 0x92, 0xcd,
+  0xeb, 0x5f, 0x63, 0x49, 0x97, 0xc8, 0x95, 0x63, 0x9c, 0xa0, 0x1f, 0xc1, 0x1c, 0xf9, 0x4b, 0xe0,
+  0x38, 0x3e, 0xf9, 0xda, 0xd2, 0xbb, 0x22, 0xba, 0xd8, 0xd7, 0xf6, 0xc5, 0xf8, 0xb6, 0xdc, 0x98,
+  0xaa, 0xeb, 0x3c, 0xfe, 0xda, 0x37, 0x18, 0xfb, 0x08, 0xd3, 0x1c, 0xe6, 0x50, 0x99, 0x5c, 0x33,
+  0xa1, 0x76, 0xb4, 0x3e, 0x39, 0xfd, 0xb2, 0x53, 0xcd, 0x8c, 0xfa, 0x55, 0xfc, 0x89, 0x9a, 0xe3,
+  0xb7, 0xd0, 0xd5, 0x75, 0x4c, 0x94, 0xfb, 0x6f, 0xed, 0x9d, 0xca, 0x9f, 0xef, 0x5b, 0x13, 0x53,
+  0xd9, 0x02, 0x60, 0x7b, 0x18, 0x04, 0xa5, 0x92, 0x28, 0xd5, 0x82, 0xb0, 0xd9, 0xc1, 0xb0, 0xea,
+  0x5d, 0xf4, 0xbb, 0x16, 0x7f, 0x9b, 0x0e, 0x55, 0xab, 0x32, 0x40, 0x60, 0xc2, 0xee, 0xb4, 0xf4,
+  0x06, 0xab, 0x35, 0x73, 0xe0, 0x24, 0x4d, 0x12, 0x4e, 0xc6, 0x36, 0x4e, 0x0d, 0x74, 0x23, 0x61,
+  0x85, 0xa2, 0x05, 0xcc, 0x5b, 0xbd, 0x7e, 0xca, 0x45, 0x24, 0x49, 0xa8, 0xbf, 0xba, 0x5f, 0x40,
+  0xf5, 0x84, 0x0f, 0xb9, 0x98, 0x1b, 0x03, 0x9a, 0xa7, 0xaf, 0x55, 0xd3, 0x99, 0x09, 0x02, 0xa6,
+  0x29, 0x85, 0x84, 0xb5, 0x1d, 0x6e, 0x3f, 0x50, 0xbf, 0x61, 0x90, 0x68, 0x5a, 0x04, 0x25, 0x14,
+  0x4c, 0x21, 0x5c, 0xe4, 0x87, 0xb0, 0x0f, 0x7b, 0x70, 0x80, 0x46, 0xe5, 0x2c, 0x59, 0x20, 0x30,
+  0x48, 0xf8, 0x5c, 0x70, 0x99, 0x8a, 0xe4, 0xb7, 0x69, 0x49, 0x38, 0x81, 0x7f, 0xbe, 0xc0, 0x08,
+  0xe1, 0x8b, 0xd0, 0x2d, 0xae, 0xba, 0x21, 0xb3, 0x40, 0x12, 0x59, 0x9e, 0xe2, 0x6c, 0x80, 0x4a,
+  0x22, 0x92, 0x71, 0xf3, 0xab, 0x92, 0x6e, 0x56, 0xd8, 0x94, 0x83, 0x49, 0x05, 0x73, 0x6a, 0xbf,
+  0x7b, 0x71, 0x0e, 0x72, 0x96, 0x97, 0x28, 0x32, 0x6e, 0x35, 0xc8, 0xf4, 0x12, 0x14, 0x72, 0x0c,
+  0x91, 0x07, 0xaf, 0x6d, 0xe3, 0xad, 0x86, 0xcd, 0xf8, 0xed, 0x2b, 0x5f, 0xd4, 0x0f, 0xf5, 0xc6,
+  0x4f, 0xe9, 0x68, 0x11, 0x3e, 0xc0, 0xc9, 0x09, 0xec, 0x3b, 0x13, 0x38, 0x0e, 0x39, 0xe4, 0x3b,
+  0xb2, 0x78, 0x75, 0x51, 0xed, 0x5a, 0x64, 0xb6, 0x32, 0xe9, 0x22, 0x19, 0x67, 0x0f, 0x1c, 0xb1,
+  0x1e, 0x15, 0xcb, 0x09, 0xbc, 0xcd, 0xb5, 0x58, 0x26, 0x74, 0x8f, 0x05, 0xb0, 0x4e, 0x0c, 0x09,
+  0x39, 0xaa, 0x77, 0xc7, 0x5c, 0x9d, 0x6a, 0x0b, 0xe0, 0x55, 0x4a, 0xf4, 0x7f, 0x14, 0x8f, 0x84,
+  0xec, 0x22, 0x0c, 0x85, 0x3a, 0xe4, 0x18, 0x36, 0xcf, 0x88, 0x6a, 0x18, 0xe4, 0x91, 0x65, 0x19,
+  0xe2, 0x19, 0x25, 0x4d, 0x92, 0x58, 0xdb, 0xf5, 0x8c, 0x12, 0x88, 0x1c, 0xdb, 0xe6, 0x53, 0x29,
+  0xd9, 0x22, 0x4e, 0x4b, 0xfd, 0x37, 0x44, 0x4b, 0x7c, 0xff, 0x0e, 0xdb, 0xdb, 0x0f, 0xce, 0x9d,
+  0x56, 0x28, 0x76, 0x76, 0xe0, 0xe1, 0xf3, 0xfe, 0x17, 0x78, 0x8f, 0x3e, 0xc4, 0xcf, 0x28, 0xbb,
+  0xf2, 0x46, 0x93, 0xde, 0xcd, 0x5a, 0xf8, 0xd9, 0x66, 0xf6, 0x23, 0x88, 0x82, 0x0d, 0x53, 0xb5,
+  0x38, 0x84, 0x03, 0x74, 0xf1, 0x68, 0x44, 0x3d, 0x3f, 0xca, 0x58, 0x76, 0xd6, 0x91, 0xec, 0xc7,
+  0x6f, 0x1b, 0xa2, 0x4b, 0xa6, 0x26, 0xf1, 0x34, 0xcd, 0x43, 0x64, 0x7c, 0xf8, 0x7c, 0xf0, 0x05,
+  0x63, 0x87, 0x54, 0x88, 0x5e, 0xc2, 0x7b, 0x60, 0xb1, 0xe1, 0x0b, 0x81, 0x75, 0x32, 0x93, 0xda,
+  0x6c, 0x87, 0x5a, 0x42, 0x07, 0xcb, 0x1a, 0x37, 0x0b, 0xe5, 0x21, 0xf4, 0xf2, 0x11, 0x3d, 0x7a,
+  0x60, 0x3c, 0x72, 0x86, 0x75, 0x61, 0x7c, 0x48, 0x49, 0xc9, 0x8b, 0x5d, 0xac, 0x16, 0x0d, 0xa6,
+  0x2f, 0x57, 0x87, 0xad, 0x35, 0x33, 0xb4, 0x07, 0x0d, 0xad, 0xdf, 0xd5, 0x56, 0xb1, 0xa1, 0x8e,
+  0x46, 0x7a, 0xc8, 0x8b, 0x25, 0xf5, 0xe4, 0xf4, 0x4a, 0x47, 0x28, 0x40, 0x2b, 0x27, 0xb4, 0x64,
+  0x33, 0xdc, 0xa3, 0x35, 0x4f, 0x6f, 0x1d, 0x97, 0xd6, 0x2c, 0xad, 0x27, 0xd7, 0xaf, 0x6e, 0x1d,
+  0x4f, 0xb4, 0x5e, 0x5a, 0xa1, 0xa6, 0x07, 0x37, 0x5f, 0x11, 0x6a, 0x86, 0xd6, 0x2b, 0xa2, 0x69,
+  0x3d, 0x45, 0x0c, 0xed, 0x13, 0x8a, 0x68, 0x72, 0x4f, 0x11, 0x43, 0xee, 0x2a, 0xf2, 0x24, 0xce,
+  0x0c, 0x0c, 0x1e, 0x85, 0x68, 0xe4, 0xaf, 0xd0, 0xbd, 0xbd, 0x7e, 0xf7, 0x96, 0x90, 0x8b, 0x72,
+  0x08, 0xa7, 0x41, 0x0d, 0x56, 0xd8, 0x09, 0xa5, 0x05, 0xf6, 0x16, 0xeb, 0xf1, 0xdb, 0x7f, 0xcf,
+  0xf0, 0x9c, 0xd4, 0xfa, 0x31, 0xf3, 0x29, 0x00, 0x27, 0xab, 0xe9, 0x1f, 0x4d, 0x42, 0x6b, 0x44,
+  0xca, 0x02, 0x17, 0xd3, 0x2b, 0x2f, 0x4e, 0x59, 0x4a, 0xd9, 0x8d, 0x48, 0xe6, 0x97, 0x68, 0x1b,
+  0xb1, 0x27, 0x4f, 0x90, 0x5b, 0x02, 0x8c, 0x64, 0xff, 0x97, 0x46, 0xb2, 0x94, 0x73, 0x38, 0x7d,
+  0x6d, 0x1f, 0x4e, 0x6b, 0xaf, 0x38, 0x7c, 0x85, 0xdc, 0x3f, 0xdc, 0x7d, 0xae, 0x23, 0x35, 0xb5,
+  0x89, 0xdd, 0x32, 0xde, 0xac, 0xfa, 0x4d, 0xb2, 0xd3, 0x30, 0x54, 0x16, 0x23, 0xb8, 0x38, 0x31,
+  0x62, 0xf0, 0xdb, 0x9e, 0xa9, 0xdf, 0xee, 0xa0, 0xf1, 0x33, 0x66, 0x9b, 0x7e, 0xd4, 0xf8, 0xef,
+  0x9f, 0xff, 0x09, 0xda, 0x75, 0x5d, 0xff, 0x28, 0x46, 0x91, 0xb3, 0xa2, 0x41, 0xb3, 0xfa, 0xa4,
+  0x06, 0x95, 0xd9, 0x2a, 0x0d, 0xaa, 0x6f, 0xaf, 0xd3, 0x00, 0x23, 0xf2, 0xad, 0x8d, 0x48, 0x82,
+  0x82, 0xff, 0x01, 0xb5, 0x2c, 0xc8, 0x75, 0xee, 0x20, 0x00, 0x00,
+};
+
+// style.css: 4694 bytes, 1496 gzipped
+constexpr uint8_t asset_style_css[] PROGMEM = {
+  0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0xb5, 0x58, 0x5d, 0x73, 0xa3, 0x36,
+  0x14, 0x7d, 0xcf, 0xaf, 0xd0, 0x6c, 0x26, 0x33, 0xf1, 0xae, 0x21, 0x02, 0x83, 0x3f, 0xc8, 0x74,
+  0xa6, 0xfd, 0x0b, 0xed, 0x4b, 0x5f, 0x05, 0x08, 0xac, 0x06, 0x10, 0x23, 0xe4, 0x75, 0xb2, 0x9d,
+  0xfd, 0xef, 0xbd, 0x57, 0x08, 0x10, 0x36, 0x4e, 0xda, 0xe9, 0x24, 0xde, 0x10, 0x23, 0x84, 0x74,
+  0xce, 0xfd, 0x38, 0xf7, 0x6a, 0x9f, 0xbe, 0x92, 0x5f, 0xf0, 0x87, 0xa4, 0xac, 0xe3, 0xa4, 0x65,
+  0x25, 0xb7, 0xf7, 0x5f, 0x9f, 0xee, 0x52, 0x99, 0xbf, 0x91, 0xbf, 0xef, 0x08, 0x29, 0x64, 0xa3,
+  0xbd, 0x82, 0xd5, 0xa2, 0x7a, 0x4b, 0xc8, 0x6f, 0x4a, 0xb0, 0x6a, 0x4d, 0x3a, 0xd6, 0x74, 0x5e,
+  0xc7, 0x95, 0x28, 0x9e, 0x61, 0x46, 0xca, 0xb2, 0x97, 0x52, 0xc9, 0x53, 0x93, 0x27, 0xa4, 0x12,
+  0x0d, 0x67, 0xca, 0x2b, 0x15, 0xcb, 0x05, 0x6f, 0xf4, 0xa3, 0x96, 0x44, 0x89, 0xf2, 0xa8, 0xd7,
+  0xe4, 0x3e, 0x88, 0x02, 0xbe, 0xa1, 0xf8, 0x25, 0x0e, 0xb3, 0x68, 0xbb, 0xc2, 0x57, 0x33, 0x59,
+  0x49, 0x95, 0x90, 0xf3, 0x51, 0x68, 0x8e, 0xf7, 0x35, 0x53, 0xa5, 0x68, 0x12, 0x42, 0xf1, 0xa6,
+  0x65, 0x79, 0x2e, 0x9a, 0x32, 0x21, 0x61, 0xd4, 0xbe, 0x92, 0x60, 0xdb, 0xbe, 0x3e, 0xdf, 0xfd,
+  0xbc, 0xbb, 0x3b, 0x06, 0x06, 0xd7, 0x38, 0x15, 0x3e, 0xf8, 0xac, 0x7f, 0x47, 0xf3, 0x57, 0xed,
+  0xb1, 0x4a, 0x94, 0xf0, 0x24, 0x03, 0x00, 0x5c, 0x39, 0xdb, 0xdc, 0x17, 0x85, 0x01, 0x6c, 0x28,
+  0x9d, 0x39, 0xe2, 0x4a, 0xc8, 0x9e, 0x52, 0xb3, 0xec, 0xd3, 0x60, 0x8c, 0x9a, 0x89, 0x06, 0xde,
+  0x68, 0x34, 0xfc, 0xe5, 0x8a, 0xb0, 0x26, 0x27, 0x19, 0x53, 0x79, 0x37, 0xd9, 0xc6, 0x6f, 0x59,
+  0xc3, 0x2b, 0x83, 0xe2, 0x2c, 0x72, 0x7d, 0x4c, 0x48, 0x40, 0xe9, 0x43, 0x8f, 0xff, 0xd5, 0xb3,
+  0x43, 0x3b, 0x4a, 0x11, 0xb0, 0x0b, 0x94, 0x9d, 0xb4, 0x9c, 0x11, 0xeb, 0x39, 0x81, 0x05, 0xe5,
+  0xab, 0xd7, 0x1d, 0x59, 0x2e, 0xcf, 0x96, 0x0f, 0xd0, 0xb9, 0xa7, 0x94, 0xa5, 0x3d, 0xde, 0x54,
+  0xaa, 0x9c, 0x2b, 0x0f, 0x6d, 0x7a, 0xea, 0xe0, 0xad, 0xc8, 0xbe, 0xe5, 0xd8, 0x5d, 0x95, 0x29,
+  0x7b, 0x0c, 0x69, 0xb0, 0x26, 0xd3, 0x85, 0xfa, 0x9b, 0xd8, 0x58, 0x39, 0x17, 0x5d, 0x5b, 0x31,
+  0x70, 0x5f, 0xa9, 0x44, 0x8e, 0x03, 0x25, 0x6b, 0x93, 0xc9, 0xa0, 0x3e, 0xd2, 0x33, 0x6c, 0xae,
+  0x56, 0x04, 0x77, 0xd9, 0x7f, 0xfe, 0x6e, 0x75, 0x03, 0xfa, 0x1c, 0x5b, 0xb8, 0xcc, 0x28, 0x44,
+  0x6b, 0x8c, 0x6b, 0x06, 0x3b, 0xc4, 0x18, 0xc7, 0x06, 0xe3, 0xaa, 0x07, 0x91, 0x02, 0xb6, 0x92,
+  0x7b, 0x47, 0xce, 0x60, 0x3d, 0x83, 0x66, 0x84, 0x5d, 0x54, 0xdc, 0x2c, 0x6a, 0xfc, 0xea, 0x41,
+  0xa8, 0xd4, 0x9d, 0xeb, 0xdd, 0xbf, 0x4e, 0x9d, 0x16, 0xc5, 0x9b, 0x87, 0x3e, 0x83, 0xc1, 0x84,
+  0x74, 0x2d, 0xcb, 0xb8, 0x97, 0x72, 0x7d, 0xe6, 0xbc, 0x99, 0xf8, 0x5a, 0x68, 0xb8, 0x9a, 0x77,
+  0x56, 0x38, 0x84, 0xd7, 0xb9, 0xf3, 0xd3, 0x93, 0xd6, 0xb2, 0x71, 0x7d, 0x9d, 0xea, 0xc6, 0x53,
+  0xf2, 0xbc, 0x8c, 0xa8, 0x5f, 0x78, 0xe6, 0x68, 0x4f, 0xcb, 0x0f, 0x36, 0xeb, 0xf7, 0x30, 0x0b,
+  0x4e, 0xe6, 0x0c, 0xc7, 0x10, 0x9f, 0x22, 0x66, 0x8c, 0xea, 0xde, 0xc8, 0x09, 0x69, 0x64, 0xc3,
+  0x17, 0x8c, 0xbe, 0xbf, 0x8e, 0x07, 0x27, 0x7a, 0x96, 0x82, 0xbf, 0x13, 0x3f, 0xf8, 0xe4, 0xc3,
+  0xec, 0xa4, 0x3a, 0x9c, 0xd2, 0x4a, 0x31, 0xd8, 0x54, 0x2b, 0x48, 0x71, 0xa1, 0x85, 0x04, 0x18,
+  0x7e, 0x18, 0x77, 0x0e, 0xf0, 0xe4, 0x28, 0xbf, 0x5b, 0x0f, 0x5d, 0xec, 0xb8, 0x8f, 0xb3, 0xcc,
+  0x9d, 0xc8, 0x32, 0x2d, 0xbe, 0xf3, 0xa5, 0x99, 0x71, 0x71, 0x38, 0xb8, 0x33, 0xc1, 0xb0, 0x2c,
+  0xad, 0xf8, 0x75, 0x14, 0xde, 0x6f, 0xe2, 0x1d, 0x63, 0xd4, 0x45, 0xd9, 0x48, 0xcc, 0xf0, 0x4a,
+  0x9e, 0xb9, 0x89, 0x65, 0x09, 0xce, 0x16, 0x1a, 0x7c, 0xe2, 0xef, 0x62, 0xb3, 0xe4, 0xfd, 0xef,
+  0xbc, 0xe3, 0xfa, 0x7a, 0xa5, 0x3c, 0x0b, 0xb7, 0xe1, 0xb6, 0x9f, 0x02, 0x5b, 0xfd, 0xa1, 0x99,
+  0x3e, 0x75, 0x8e, 0x94, 0x58, 0xc7, 0x59, 0x67, 0x3a, 0x66, 0x0a, 0x23, 0x67, 0x68, 0x90, 0x8d,
+  0x54, 0x56, 0xf9, 0x2d, 0xc1, 0x71, 0x03, 0x0a, 0x0c, 0x59, 0x14, 0x22, 0x73, 0x02, 0xca, 0x8e,
+  0x78, 0x98, 0x8c, 0xf3, 0xa8, 0x1a, 0xd3, 0x13, 0xfe, 0x7a, 0x10, 0xe5, 0x30, 0xaa, 0x39, 0x84,
+  0x75, 0x75, 0xaa, 0x1b, 0x70, 0xb3, 0xe2, 0x2d, 0x67, 0xfa, 0x31, 0x5c, 0x93, 0x5a, 0x34, 0xa0,
+  0x34, 0x26, 0x93, 0x0a, 0xb5, 0x5a, 0x2d, 0xa4, 0xb4, 0xae, 0x3c, 0x48, 0x41, 0x72, 0xdc, 0xcc,
+  0xb4, 0x72, 0x8f, 0x01, 0x35, 0x52, 0x5c, 0xd6, 0xca, 0x19, 0xcb, 0xc3, 0x24, 0x8e, 0xb0, 0xa7,
+  0x18, 0xd9, 0x3c, 0x42, 0x04, 0x68, 0x91, 0xb1, 0x6a, 0x65, 0x28, 0xe1, 0x33, 0x6f, 0x78, 0xe6,
+  0xca, 0xe2, 0xb0, 0xd5, 0xd1, 0xae, 0x17, 0xc5, 0xb7, 0x45, 0x51, 0x0e, 0xf1, 0xa6, 0x38, 0xf0,
+  0x86, 0xc0, 0x59, 0x92, 0x17, 0x1b, 0xea, 0xb3, 0xbc, 0xf9, 0xa8, 0x06, 0x05, 0x7b, 0x9a, 0xf3,
+  0x12, 0x0b, 0x4f, 0x00, 0xb2, 0x73, 0x4f, 0x19, 0x7e, 0xc8, 0x96, 0x3e, 0xac, 0xae, 0x95, 0x0a,
+  0x2d, 0x84, 0x9b, 0x5c, 0xc8, 0x1f, 0x2a, 0xe9, 0x9a, 0x88, 0x06, 0x03, 0x8b, 0x9a, 0x4f, 0xd4,
+  0x4b, 0x34, 0xdd, 0xcd, 0x87, 0x8d, 0x72, 0x43, 0xa6, 0x05, 0xcf, 0x4b, 0x72, 0x61, 0xd4, 0x20,
+  0x17, 0x8a, 0x67, 0x3d, 0xd3, 0xde, 0xb5, 0xff, 0x4e, 0xc3, 0x16, 0xc5, 0x0f, 0x5d, 0x5d, 0x6b,
+  0x98, 0xf6, 0xc3, 0xd6, 0xa3, 0xc9, 0x8a, 0x2c, 0xed, 0x60, 0xf5, 0xbe, 0xac, 0x1a, 0x84, 0x93,
+  0x4e, 0xdc, 0x28, 0x27, 0x8e, 0x21, 0x5c, 0x4a, 0x1b, 0xcb, 0x74, 0xbf, 0xcc, 0x14, 0xc9, 0xb2,
+  0xde, 0x81, 0x46, 0x3d, 0x3c, 0xfe, 0x1d, 0xc0, 0x75, 0x83, 0x58, 0x59, 0x84, 0x15, 0xab, 0xdb,
+  0x79, 0xb0, 0xa7, 0x95, 0xcc, 0x5e, 0x9e, 0xa7, 0x58, 0xd9, 0x5f, 0x84, 0xca, 0x8e, 0x2e, 0xa2,
+  0x3d, 0x1c, 0x0e, 0x0b, 0xd5, 0x0f, 0x1e, 0xb2, 0x6a, 0xf2, 0x78, 0x84, 0xc5, 0xc6, 0x5c, 0x98,
+  0x26, 0x9b, 0xf8, 0x81, 0x6c, 0xe8, 0xc3, 0x7a, 0x40, 0x1b, 0x42, 0x02, 0x19, 0x79, 0x6b, 0x99,
+  0x82, 0xc9, 0x24, 0x8e, 0x1f, 0x56, 0x18, 0x1c, 0x45, 0x78, 0xd8, 0xec, 0x6e, 0x19, 0x02, 0xa5,
+  0x18, 0x83, 0xd9, 0x58, 0x82, 0x4d, 0x96, 0xf0, 0x4c, 0xc0, 0x84, 0xd3, 0x83, 0x79, 0x74, 0xec,
+  0x67, 0x06, 0xf8, 0x36, 0xb3, 0xc4, 0xb5, 0xea, 0x38, 0x53, 0x7d, 0xc5, 0x73, 0xdf, 0x16, 0x89,
+  0x77, 0x99, 0xe2, 0x4e, 0xe6, 0x82, 0x4c, 0xc3, 0x07, 0x12, 0xee, 0x2d, 0xd3, 0xed, 0x22, 0x4b,
+  0x5e, 0x44, 0xf0, 0xf3, 0x7f, 0x59, 0xc2, 0xeb, 0xa4, 0x0f, 0x02, 0x7c, 0x10, 0x0d, 0xe9, 0x12,
+  0x6e, 0x0e, 0x6b, 0xb2, 0xdd, 0xf7, 0xbf, 0xfe, 0x76, 0xf5, 0xbe, 0x35, 0xfc, 0x37, 0x8e, 0x2a,
+  0xfe, 0x19, 0x2c, 0x8b, 0xf8, 0xc0, 0x69, 0xfa, 0x59, 0x2c, 0x23, 0xe8, 0x5b, 0x82, 0x18, 0x28,
+  0xa2, 0x9c, 0xf8, 0x71, 0xfc, 0x11, 0xcf, 0x52, 0x41, 0x0a, 0x7f, 0x06, 0xcd, 0x30, 0xcc, 0xe2,
+  0x98, 0x7f, 0x12, 0xcd, 0x4d, 0x04, 0x04, 0x0f, 0x20, 0x6f, 0x87, 0xe8, 0x3d, 0x96, 0x50, 0x19,
+  0x32, 0x60, 0xa3, 0x61, 0x6b, 0xe8, 0x9a, 0x8f, 0xa2, 0xed, 0xfa, 0x8a, 0xa0, 0x3d, 0x2d, 0x6a,
+  0xdb, 0x26, 0x2c, 0x8b, 0x52, 0xc5, 0x0b, 0x48, 0xf3, 0xb8, 0x6f, 0x9c, 0x0d, 0xbb, 0x42, 0xaa,
+  0x3a, 0xe9, 0xbf, 0x62, 0xe5, 0xfb, 0xf3, 0xd1, 0x8b, 0x47, 0x91, 0x86, 0x36, 0xa1, 0x76, 0x5a,
+  0x2d, 0x48, 0x1c, 0xab, 0x1b, 0xd1, 0xf6, 0xbd, 0x6a, 0x36, 0x16, 0x0a, 0x44, 0x7d, 0x43, 0xff,
+  0x9c, 0x8a, 0x0f, 0x3d, 0x17, 0xa5, 0x46, 0x11, 0x9f, 0x02, 0x3f, 0x24, 0xdd, 0x5b, 0x07, 0x7a,
+  0xeb, 0x9d, 0xc4, 0x7a, 0xf9, 0xe4, 0x33, 0xb4, 0x56, 0x3c, 0xe6, 0x3b, 0x9e, 0x2e, 0xf7, 0xe4,
+  0x90, 0x0d, 0xd0, 0xeb, 0x6e, 0xc0, 0x86, 0xbb, 0x95, 0xdb, 0xcb, 0xa1, 0x7e, 0x82, 0x31, 0xa0,
+  0x07, 0x30, 0xf3, 0x82, 0x08, 0x03, 0x6a, 0x0b, 0xf3, 0x82, 0x3d, 0x1a, 0x3c, 0xec, 0x5b, 0x77,
+  0x5c, 0x2f, 0x57, 0xb2, 0xf5, 0x0a, 0x51, 0x69, 0x7c, 0x2d, 0xad, 0x4e, 0xea, 0x11, 0x9c, 0xb7,
+  0x1a, 0xac, 0xdf, 0xd5, 0xd0, 0x0c, 0x91, 0x2e, 0xc3, 0x20, 0x33, 0xb6, 0xff, 0xb5, 0xe6, 0x10,
+  0x56, 0xe4, 0xd1, 0x39, 0x8b, 0xc4, 0x21, 0x70, 0x5c, 0x19, 0x5f, 0x5c, 0xb7, 0x1f, 0x37, 0xfb,
+  0x0d, 0xe8, 0x2d, 0x10, 0xc2, 0xcf, 0xa1, 0x01, 0x90, 0x39, 0x27, 0x5a, 0x96, 0x65, 0xc5, 0x7b,
+  0x17, 0xc3, 0xbd, 0x67, 0xef, 0xff, 0x4b, 0xbb, 0xee, 0xf4, 0xcc, 0x26, 0x4b, 0x70, 0x99, 0x8a,
+  0xa5, 0xb6, 0x80, 0xcd, 0xda, 0x8f, 0x1d, 0xa5, 0xae, 0x99, 0xf3, 0x94, 0xb3, 0xc2, 0xd6, 0x94,
+  0xee, 0x2c, 0x74, 0x76, 0xbc, 0x08, 0x2f, 0xb7, 0x73, 0x18, 0xe1, 0x88, 0x06, 0x1b, 0x02, 0xef,
+  0x03, 0x54, 0x83, 0xa5, 0xa2, 0x79, 0x15, 0xda, 0x8c, 0x38, 0xed, 0x86, 0xa2, 0x69, 0x4f, 0xfa,
+  0xe3, 0x52, 0x4b, 0x67, 0xad, 0x29, 0x5d, 0xec, 0xb2, 0xcd, 0xaa, 0x10, 0x00, 0x57, 0x59, 0xe2,
+  0xd2, 0xb8, 0x38, 0x60, 0x0e, 0xb8, 0x86, 0xfb, 0x59, 0x87, 0xbb, 0x8d, 0x76, 0xd1, 0x3e, 0xbd,
+  0x6c, 0xdf, 0xa7, 0x29, 0x10, 0x55, 0xdd, 0xda, 0xd1, 0x0a, 0xbc, 0xbf, 0x5d, 0x62, 0x27, 0x78,
+  0x49, 0xca, 0x21, 0x35, 0xf9, 0x3b, 0xac, 0xc7, 0xb6, 0xe5, 0xcb, 0x17, 0x17, 0x65, 0x68, 0xbb,
+  0x33, 0x4b, 0x62, 0xb8, 0xed, 0x33, 0xdf, 0x5a, 0xda, 0xd4, 0xbf, 0x85, 0x13, 0xed, 0xf8, 0x7f,
+  0x02, 0x2e, 0x97, 0x51, 0x26, 0x6e, 0x40, 0xb7, 0x6a, 0x32, 0xef, 0xe9, 0x30, 0xd3, 0x36, 0xd7,
+  0x2d, 0x5d, 0xb8, 0xba, 0x76, 0x6c, 0x92, 0x1d, 0x79, 0xf6, 0xc2, 0xf3, 0x6f, 0xae, 0x63, 0x66,
+  0x36, 0x0e, 0x68, 0x7a, 0xd8, 0x07, 0x1f, 0xbf, 0xe9, 0xda, 0x6c, 0x59, 0xdc, 0xf0, 0x58, 0x61,
+  0x21, 0x1c, 0x21, 0x22, 0xae, 0x7a, 0x02, 0xab, 0x56, 0x43, 0xf0, 0x67, 0x69, 0x1e, 0xf3, 0xe0,
+  0xe2, 0x68, 0xe2, 0x1f, 0x14, 0xaf, 0xdf, 0x39, 0x86, 0x0c, 0xa7, 0x6a, 0x25, 0xa5, 0x26, 0xfe,
+  0x19, 0xbf, 0x5f, 0x6f, 0x34, 0x34, 0x80, 0x56, 0x2b, 0xe7, 0xe7, 0x20, 0x6b, 0xe0, 0x7e, 0x0c,
+  0x8c, 0x98, 0xb3, 0xee, 0xc8, 0xad, 0x66, 0x99, 0x13, 0xfc, 0x74, 0xa1, 0xbd, 0x49, 0xff, 0x01,
+  0x16, 0x49, 0x1e, 0xd2, 0x56, 0x12, 0x00, 0x00,
+};
+
+constexpr WebAsset WEB_ASSETS[] = {
+  {"/bridgeController.js", "application/javascript", "\"aaa49bcb36e93c33\"", asset_bridgeController_js, sizeof(asset_bridgeController_js)},
+  {"/index.html", "text/html", "\"130aa1952f1ced19\"", asset_index_html, sizeof(asset_index_html)},
+  {"/script.js", "application/javascript", "\"38810028bd8ee488\"", asset_script_js, sizeof(asset_script_js)},
+  {"/style.css", "text/css", "\"4c0c241307f04634\"", asset_style_css, sizeof(asset_style_css)},
+};
+constexpr size_t WEB_ASSET_COUNT = sizeof(WEB_ASSETS) / sizeof(WEB_ASSETS[0]);
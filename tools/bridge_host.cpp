@@ -0,0 +1,79 @@
+// Host build of the bridge controller: runs the unmodified firmware
+// (src/main.cpp) as a Linux process against the stand-ins in host/.
+//
+//   g++ -std=c++17 -O2 -Ihost tools/bridge_host.cpp -o bridge_host -pthread
+//   ./bridge_host --port 8080 --echo-cm 200
+//
+// Options:
+//   --port N       HTTP port (the firmware asks for 80)
+//   --echo-cm D    constant distance both ultrasonic sensors report, 0 = no echo
+//   --ap-ms N      simulated Wi-Fi join time, -1 = access point absent
+//   --poll-ms N    async_tcp connection poll interval (default 500, as lwIP)
+//   --id N         bridge id on the corridor (default 1)
+//   --pos-cm X     bridge position along the channel (default 0)
+//   --udp-loss P   drop P% of corridor datagrams on send
+//   --quiet        drop Serial output
+//   --run-ms N     stop after N ms and print the boot timeline; exits 1 if
+//                  the first control tick missed FIRST_TICK_BUDGET_MS
+//
+// Several bridges on one channel, each with its own HTTP port:
+//   ./bridge_host --port 8081 --id 1 --pos-cm 0 &
+//   ./bridge_host --port 8082 --id 2 --pos-cm 500 &
+//   curl localhost:8082/corridor
+//
+// Boot against a slow or absent access point:
+//   ./bridge_host --ap-ms 30000 --run-ms 20000
+//   ./bridge_host --ap-ms -1 --run-ms 5000
+#include "../src/main.cpp"
+
+#include <string>
+
+int main(int argc, char **argv)
+{
+  float echoCm = 200;
+  long runMs = -1;
+  for (int i = 1; i < argc; i++)
+  {
+    std::string a = argv[i];
+    const char *v = i + 1 < argc ? argv[i + 1] : "";
+    if (a == "--port")
+      hostHttpPort = atoi(v), i++;
+    else if (a == "--echo-cm")
+      echoCm = (float)atof(v), i++;
+    else if (a == "--ap-ms")
+      hostWiFiConnectMs = atol(v), i++;
+    else if (a == "--poll-ms")
+      hostTcpPollMs = atoi(v), i++;
+    else if (a == "--run-ms")
+      runMs = atol(v), i++;
+    else if (a == "--id")
+      CORRIDOR_ID = (uint8_t)atoi(v), i++;
+    else if (a == "--pos-cm")
+      CORRIDOR_POS_CM = atol(v), i++;
+    else if (a == "--udp-loss")
+      hostUdpLossPct = atoi(v), i++;
+    else if (a == "--quiet")
+      hostSerialQuiet = true;
+    else
+    {
+      fprintf(stderr, "unknown option %s\n", a.c_str());
+      return 1;
+    }
+  }
+
+  // Echo pulse width for a target echoCm away (inverse of getDistance)
+  unsigned long echoUs = (unsigned long)(echoCm * 2.0f / 0.034f);
+  hostEchoModel = [echoUs](int) { return echoUs; };
+
+  setup();
+  while (runMs < 0 || (long)millis() < runMs)
+    loop();
+
+  printf("first control tick: %lu ms (budget %lu ms)\n", firstTickMs, FIRST_TICK_BUDGET_MS);
+  if (linkUpMs)
+    printf("link up / HTTP server: %lu ms\n", linkUpMs);
+  else
+    printf("link up / HTTP server: not yet, %lu control ticks run without it\n", (unsigned long)tickCount.load());
+  server.end();
+  return firstTickMs <= FIRST_TICK_BUDGET_MS ? 0 : 1;
+}
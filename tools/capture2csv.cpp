@@ -0,0 +1,82 @@
+// Decodes a raw ranging capture (GET /capture/data) into CSV.
+//
+//   g++ -std=c++17 -O2 tools/capture2csv.cpp -o capture2csv
+//   curl -s -XPOST http://<board>/capture/start
+//   ...
+//   curl -s -XPOST http://<board>/capture/stop
+//   curl -s http://<board>/capture/data -o capture.brc
+//   ./capture2csv capture.brc > capture.csv
+//
+// Record layout is documented next to captureEcho() in src/main.cpp.
+#include <cstdint>
+#include <cstdio>
+#include <vector>
+
+static bool getVarint(const std::vector<uint8_t> &b, size_t &pos, uint32_t &v)
+{
+  v = 0;
+  for (int shift = 0; shift < 35 && pos < b.size(); shift += 7)
+  {
+    uint8_t c = b[pos++];
+    v |= (uint32_t)(c & 0x7f) << shift;
+    if (!(c & 0x80))
+      return true;
+  }
+  return false;
+}
+
+static uint32_t getU32(const std::vector<uint8_t> &b, size_t at)
+{
+  return b[at] | b[at + 1] << 8 | b[at + 2] << 16 | (uint32_t)b[at + 3] << 24;
+}
+
+int main(int argc, char **argv)
+{
+  FILE *in = argc > 1 ? fopen(argv[1], "rb") : stdin;
+  if (!in)
+  {
+    perror(argv[1]);
+    return 1;
+  }
+  std::vector<uint8_t> b;
+  uint8_t chunk[4096];
+  size_t n;
+  while ((n = fread(chunk, 1, sizeof(chunk), in)) > 0)
+    b.insert(b.end(), chunk, chunk + n);
+
+  if (b.size() < 16 || b[0] != 'B' || b[1] != 'R' || b[2] != 'C' || b[3] != '1')
+  {
+    fprintf(stderr, "not a BRC1 capture\n");
+    return 1;
+  }
+  uint32_t records = getU32(b, 8);
+  uint32_t dropped = getU32(b, 12);
+
+  printf("t_us,sensor,echo_us,distance_cm\n");
+  size_t pos = 16;
+  uint64_t t = 0;
+  long lastEcho[2] = {0, 0};
+  uint32_t decoded = 0;
+  while (pos < b.size())
+  {
+    uint32_t tag, zz;
+    if (!getVarint(b, pos, tag) || !getVarint(b, pos, zz))
+    {
+      fprintf(stderr, "truncated record at byte %zu\n", pos);
+      return 1;
+    }
+    int sensor = tag & 1;
+    t += tag >> 1;
+    int32_t delta = (int32_t)(zz >> 1) ^ -(int32_t)(zz & 1);
+    long echo = lastEcho[sensor] + delta;
+    lastEcho[sensor] = echo;
+    // Same conversion and 400 cm cap as echoToCm()
+    float cm = echo * 0.034f / 2.0f;
+    if (cm == 0 || cm > 400)
+      cm = 400.0f;
+    printf("%llu,%c,%ld,%.1f\n", (unsigned long long)t, sensor ? 'B' : 'A', echo, cm);
+    decoded++;
+  }
+  fprintf(stderr, "%u records (%u expected), %u dropped when the buffer filled\n", decoded, records, dropped);
+  return decoded == records ? 0 : 1;
+}
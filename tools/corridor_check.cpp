@@ -0,0 +1,177 @@
+// Green-wave check for the bridge-to-bridge protocol (src/corridor.h).
+// Runs several controllers on one host, each in its own fork()ed process with
+// its own id, channel position and HTTP port. They talk over UDP multicast
+// on loopback (host/WiFiUdp.h). One boat sails down the channel at a steady
+// speed, and each process feeds its ultrasonic sensors from that boat.
+//
+//   g++ -std=c++17 -O2 -Ihost tools/corridor_check.cpp -o corridor_check -pthread
+//   ./corridor_check --bridges 3 --spacing-cm 500 --speed-cms 25 --loss 30
+//
+// Options:
+//   --bridges N      controllers, from position 0 up (default 3)
+//   --spacing-cm D   distance between bridges (default 500)
+//   --speed-cms V    boat speed (default 25; the bridges assume 20 until timed)
+//   --loss P         percent of datagrams dropped on send (default 0)
+//   --no-staging     share tracks but do not open ahead (baseline)
+//   --port N         first HTTP port, one per bridge (default 8100)
+//
+// Real time: a run lasts as long as the boat takes to pass the last bridge,
+// plus a clear window. Per bridge it prints when the deck was fully open
+// against when the boat reached the bridge, and how long the road was shut.
+// With staging on, exits 1 unless every bridge after the first was fully
+// open before the boat got there.
+//
+// Every run joins the same multicast group and port, so run one at a time.
+#include "../src/main.cpp"
+
+#include <sys/mman.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+struct BridgeResult
+{
+  long openMs;     // deck first fully open, ms after the start; -1 never
+  long roadShutMs; // road not green
+  uint32_t sent, received, lost;
+  bool done;
+};
+
+static long startMs = 0;
+static double boatSpeedCms = 25, boatFromCm = -100;
+
+static double boatCm()
+{
+  return boatFromCm + boatSpeedCms * (long)(millis() - startMs) / 1000.0;
+}
+
+// Sensor A faces lower positions, B higher; nothing beyond 400 cm
+static unsigned long echo(int pin)
+{
+  double d = boatCm() - CORRIDOR_POS_CM;
+  if (pin == echoPin_A)
+    d = -d;
+  if (d < 0 || d > 400)
+    return 0;
+  return (unsigned long)(d * 2 / 0.034);
+}
+
+static void runBridge(int i, int spacing, long runMs, BridgeResult &r)
+{
+  CORRIDOR_ID = (uint8_t)(i + 1);
+  CORRIDOR_POS_CM = i * spacing;
+  hostHttpPort = hostHttpPort.load() + i;
+  hostSerialQuiet = true;
+  hostEchoModel = echo;
+  setup();
+  r.openMs = -1;
+  unsigned long shutSince = 0;
+  while ((long)(millis() - startMs) < runMs)
+  {
+    loop();
+    unsigned long now = millis();
+    if (currentState == BRIDGE_OPEN && r.openMs < 0)
+      r.openMs = (long)(now - startMs);
+    bool shut = currentState != IDLE;
+    if (shut && !shutSince)
+      shutSince = now;
+    else if (!shut && shutSince)
+    {
+      r.roadShutMs += (long)(now - shutSince);
+      shutSince = 0;
+    }
+  }
+  if (shutSince)
+    r.roadShutMs += (long)(millis() - shutSince);
+  r.sent = corridor.sent();
+  r.received = corridor.received();
+  r.lost = corridor.lost();
+  r.done = true;
+  server.end();
+}
+
+int main(int argc, char **argv)
+{
+  int bridges = 3, spacing = 500;
+  bool staging = true;
+  for (int i = 1; i < argc; i++)
+  {
+    std::string a = argv[i];
+    const char *v = i + 1 < argc ? argv[i + 1] : "";
+    if (a == "--bridges")
+      bridges = atoi(v), i++;
+    else if (a == "--spacing-cm")
+      spacing = atoi(v), i++;
+    else if (a == "--speed-cms")
+      boatSpeedCms = atof(v), i++;
+    else if (a == "--loss")
+      hostUdpLossPct = atoi(v), i++;
+    else if (a == "--no-staging")
+      staging = false;
+    else if (a == "--port")
+      hostHttpPort = atoi(v), i++;
+    else
+    {
+      fprintf(stderr, "unknown option %s\n", a.c_str());
+      return 1;
+    }
+  }
+  if (bridges < 1 || bridges > CORR_PEERS || spacing <= 0 || boatSpeedCms <= 0)
+  {
+    fprintf(stderr, "bad geometry\n");
+    return 1;
+  }
+  if (hostHttpPort.load() == 8080)
+    hostHttpPort = 8100;
+  CORRIDOR_STAGING = staging;
+
+  BridgeResult *results = (BridgeResult *)mmap(nullptr, sizeof(BridgeResult) * bridges, PROT_READ | PROT_WRITE,
+                                               MAP_SHARED | MAP_ANONYMOUS, -1, 0);
+  if (results == MAP_FAILED)
+  {
+    perror("mmap");
+    return 1;
+  }
+  memset(results, 0, sizeof(BridgeResult) * bridges);
+
+  // Every process shares the parent's clock origin, so one start time does
+  double lastArriveS = ((bridges - 1) * spacing - boatFromCm) / boatSpeedCms;
+  long runMs = (long)(lastArriveS * 1000) + 400 * 1000 / (long)boatSpeedCms + CLEAR_WINDOW_MS + 2000;
+  startMs = (long)millis() + 500;
+  fflush(stdout);
+  for (int i = 0; i < bridges; i++)
+  {
+    pid_t pid = fork();
+    if (pid < 0)
+    {
+      perror("fork");
+      return 1;
+    }
+    if (pid == 0)
+    {
+      runBridge(i, spacing, runMs, results[i]);
+      _exit(0);
+    }
+  }
+  fprintf(stderr, "%d bridges, %d cm apart, boat at %.0f cm/s, %d%% loss, staging %s: %.0f s\n", bridges, spacing,
+          boatSpeedCms, hostUdpLossPct.load(), staging ? "on" : "off", runMs / 1000.0);
+  for (int i = 0; i < bridges; i++)
+  {
+    int status;
+    wait(&status);
+  }
+
+  int failures = 0;
+  printf("bridge  pos_cm  arrive_ms  open_ms  open_ahead_ms  road_shut_ms  sent  recv  lost\n");
+  for (int i = 0; i < bridges; i++)
+  {
+    BridgeResult &r = results[i];
+    long arrive = (long)((i * spacing - boatFromCm) * 1000 / boatSpeedCms);
+    long ahead = r.openMs < 0 ? 0 : arrive - r.openMs;
+    printf("%6d  %6d  %9ld  %7ld  %13ld  %12ld  %4u  %4u  %4u%s\n", i + 1, i * spacing, arrive, r.openMs, ahead,
+           r.roadShutMs, (unsigned)r.sent, (unsigned)r.received, (unsigned)r.lost, r.done ? "" : "  (died)");
+    if (!r.done || (staging && i > 0 && (r.openMs < 0 || ahead < 0)))
+      failures++;
+  }
+  printf("%s\n", failures ? "FAIL" : "ok");
+  return failures ? 1 : 0;
+}
@@ -0,0 +1,87 @@
+#!/usr/bin/env python3
+"""Compile the dashboard files in data/ into src/web_assets.h.
+
+Each file becomes a gzipped constexpr byte array with its length, MIME type
+and ETag worked out here, so the firmware serves the UI straight from flash
+with no filesystem. Run it after editing anything in data/ and commit the
+regenerated header:
+
+    python3 tools/embed_assets.py [data_dir] [output_header]
+"""
+import gzip
+import hashlib
+import os
+import re
+import sys
+
+MIME = {
+    ".html": "text/html",
+    ".js": "application/javascript",
+    ".css": "text/css",
+    ".json": "application/json",
+    ".svg": "image/svg+xml",
+    ".png": "image/png",
+    ".ico": "image/x-icon",
+}
+
+
+def symbol(name):
+    return "asset_" + re.sub(r"[^0-9A-Za-z]", "_", name)
+
+
+def main():
+    root = os.path.dirname(os.path.dirname(os.path.abspath(__file__)))
+    data_dir = sys.argv[1] if len(sys.argv) > 1 else os.path.join(root, "data")
+    out_path = sys.argv[2] if len(sys.argv) > 2 else os.path.join(root, "src", "web_assets.h")
+
+    names = sorted(n for n in os.listdir(data_dir) if os.path.isfile(os.path.join(data_dir, n)))
+    out = [
+        "// Generated by tools/embed_assets.py from data/. Do not edit by hand:",
+        "// change the files in data/ and re-run the script.",
+        "#pragma once",
+        "",
+        "#include <Arduino.h>",
+        "",
+        "struct WebAsset",
+        "{",
+        "  const char *path;",
+        "  const char *mime;",
+        "  const char *etag;  // quoted, ready for the ETag header",
+        "  const uint8_t *gz; // gzip-compressed body",
+        "  size_t len;",
+        "};",
+        "",
+    ]
+    entries = []
+    raw_total = gz_total = 0
+    for name in names:
+        raw = open(os.path.join(data_dir, name), "rb").read()
+        # mtime=0 keeps the output byte-identical for unchanged input
+        gz = gzip.compress(raw, compresslevel=9, mtime=0)
+        etag = '"' + hashlib.sha1(raw).hexdigest()[:16] + '"'
+        mime = MIME.get(os.path.splitext(name)[1].lower(), "application/octet-stream")
+        sym = symbol(name)
+        raw_total += len(raw)
+        gz_total += len(gz)
+
+        out.append("// %s: %d bytes, %d gzipped" % (name, len(raw), len(gz)))
+        out.append("constexpr uint8_t %s[] PROGMEM = {" % sym)
+        for i in range(0, len(gz), 16):
+            out.append("  " + ", ".join("0x%02x" % b for b in gz[i:i + 16]) + ",")
+        out.append("};")
+        out.append("")
+        entries.append('  {"/%s", "%s", "%s", %s, sizeof(%s)},' % (name, mime, etag.replace('"', '\\"'), sym, sym))
+
+    out.append("constexpr WebAsset WEB_ASSETS[] = {")
+    out.extend(entries)
+    out.append("};")
+    out.append("constexpr size_t WEB_ASSET_COUNT = sizeof(WEB_ASSETS) / sizeof(WEB_ASSETS[0]);")
+    out.append("")
+
+    with open(out_path, "w") as f:
+        f.write("\n".join(out))
+    print("%d assets, %d bytes -> %d gzipped, wrote %s" % (len(names), raw_total, gz_total, out_path))
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,213 @@
+// Emergency-stop latency check. Runs the firmware (src/main.cpp) with its
+// HTTP server and control loop, loads it with dashboard traffic and busy
+// threads, and trips the e-stop over and over while the deck is moving,
+// alternating the button input and POST /stop.
+//
+//   g++ -std=c++17 -O2 -Ihost tools/estop_check.cpp -o estop_check -pthread
+//   ./estop_check --trips 40 --load 8 --burn 2
+//
+// Options:
+//   --trips N      trips to run (default 40)
+//   --bound-us N   button: worst case from the pin edge (default ESTOP_BOUND_US)
+//   --api-bound-us N
+//                  POST /stop: worst case from the request being sent
+//                  (default ESTOP_API_BOUND_US)
+//   --load N       threads polling the status routes (default 4)
+//   --burn N       threads spinning on the CPU (default 0)
+//   --port N       HTTP port (default 8080)
+//
+// After every trip it checks straight away that the motor enable pin is low
+// and no longer driven by LEDC. Each cut is timed end to end against the
+// firmware's cut stamp (estopCutUs, esp_timer): for the button from the pin
+// edge, for the API from the moment the request is sent, so time spent
+// queued in the network stack and the HTTP server counts. Exits 1 if any
+// trip left the drive on or took longer than its bound.
+//
+// On the host the button ISR runs on the thread that moves the pin, so the
+// hardware interrupt latency of the board is not part of the figure.
+#include "../src/main.cpp"
+
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+
+static std::atomic<bool> running(true);
+
+// One request per connection; returns the body, or "" on failure. sentUs,
+// if given, gets the esp_timer stamp just before the request goes out.
+static std::string http(const char *method, const std::string &path, uint32_t *sentUs = nullptr)
+{
+  int fd = socket(AF_INET, SOCK_STREAM, 0);
+  sockaddr_in addr{};
+  addr.sin_family = AF_INET;
+  addr.sin_port = htons((uint16_t)hostHttpPort.load());
+  addr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+  timeval tv{2, 0};
+  setsockopt(fd, SOL_SOCKET, SO_RCVTIMEO, &tv, sizeof(tv));
+  int one = 1;
+  setsockopt(fd, IPPROTO_TCP, TCP_NODELAY, &one, sizeof(one));
+  std::string raw;
+  if (connect(fd, (sockaddr *)&addr, sizeof(addr)) == 0)
+  {
+    std::string req = std::string(method) + " " + path + " HTTP/1.1\r\nHost: bridge\r\nConnection: close\r\n\r\n";
+    if (sentUs)
+      *sentUs = (uint32_t)esp_timer_get_time();
+    if (send(fd, req.data(), req.size(), MSG_NOSIGNAL) == (ssize_t)req.size())
+    {
+      char buf[2048];
+      ssize_t n;
+      while ((n = recv(fd, buf, sizeof(buf), 0)) > 0)
+        raw.append(buf, n);
+    }
+  }
+  close(fd);
+  size_t hdrEnd = raw.find("\r\n\r\n");
+  return hdrEnd == std::string::npos ? std::string() : raw.substr(hdrEnd + 4);
+}
+
+// Polls /state until it reports state (or, with is = false, anything else)
+static bool waitForState(const char *state, int timeoutMs, bool is = true)
+{
+  std::string want = std::string("\"state\":\"") + state + "\"";
+  for (int t = 0; t < timeoutMs; t += 5)
+  {
+    std::string body = http("GET", "/state");
+    if (!body.empty() && (body.find(want) != std::string::npos) == is)
+      return true;
+    std::this_thread::sleep_for(std::chrono::milliseconds(5));
+  }
+  return false;
+}
+
+// The drive is cut when EN is low and no LEDC channel still owns it
+static bool driveCut()
+{
+  int en = deck.drive().en;
+  return hostPinLevel[en].load() == LOW && hostLedcPin[deck.drive().channel].load() != en;
+}
+
+int main(int argc, char **argv)
+{
+  int trips = 40, load = 4, burn = 0;
+  uint32_t boundUs = ESTOP_BOUND_US, apiBoundUs = ESTOP_API_BOUND_US;
+  for (int i = 1; i < argc; i++)
+  {
+    std::string a = argv[i];
+    const char *v = i + 1 < argc ? argv[i + 1] : "";
+    if (a == "--trips")
+      trips = atoi(v), i++;
+    else if (a == "--bound-us")
+      boundUs = (uint32_t)atol(v), i++;
+    else if (a == "--api-bound-us")
+      apiBoundUs = (uint32_t)atol(v), i++;
+    else if (a == "--load")
+      load = atoi(v), i++;
+    else if (a == "--burn")
+      burn = atoi(v), i++;
+    else if (a == "--port")
+      hostHttpPort = atoi(v), i++;
+    else
+    {
+      fprintf(stderr, "unknown option %s\n", a.c_str());
+      return 1;
+    }
+  }
+
+  hostSerialQuiet = true;
+  hostEchoModel = [](int) { return 0UL; }; // no boats: only the test moves the deck
+  setup();
+  std::thread loopThread([] {
+    while (running.load())
+      loop();
+  });
+  while (!waitForState("IDLE", 100))
+    ;
+
+  std::vector<std::thread> extra;
+  for (int i = 0; i < load; i++)
+    extra.emplace_back([] {
+      const char *routes[] = {"/state", "/lights", "/timers", "/metrics"};
+      for (int n = 0; running.load(); n++)
+        http("GET", routes[n % 4]);
+    });
+  for (int i = 0; i < burn; i++)
+    extra.emplace_back([] {
+      volatile uint64_t x = 0;
+      while (running.load())
+        x = x + 1;
+    });
+
+  http("POST", "/mode?value=manual");
+  std::mt19937 rng(1);
+  std::vector<uint32_t> cutUs[2]; // button, api
+  int failures = 0;
+  for (int t = 0; t < trips; t++)
+  {
+    // Alternate the direction so the deck keeps moving between the stops
+    http("POST", t % 2 ? "/led/off" : "/led/on");
+    std::this_thread::sleep_for(std::chrono::milliseconds(50 + rng() % 400));
+
+    bool button = t % 2 == 0;
+    uint32_t trips0 = estopTrips.load(), startUs = 0;
+    if (button)
+    {
+      startUs = (uint32_t)esp_timer_get_time();
+      hostSetInput(estopPin, LOW);
+    }
+    else
+      http("POST", "/stop", &startUs);
+    bool cut = driveCut();
+    bool tripped = estopTrips.load() != trips0;
+    uint32_t us = tripped ? estopCutUs.load() - startUs : UINT32_MAX;
+    uint32_t bound = button ? boundUs : apiBoundUs;
+    cutUs[!button].push_back(us);
+    if (!cut || !tripped || us > bound)
+    {
+      failures++;
+      fprintf(stderr, "trip %d (%s): drive %s, cut %u us (bound %u us)\n", t, button ? "button" : "api",
+              cut ? "off" : "STILL ON", us, bound);
+    }
+
+    if (!waitForState("FAULT", 2000))
+    {
+      failures++;
+      fprintf(stderr, "trip %d: controller never entered FAULT\n", t);
+    }
+    if (button)
+      hostSetInput(estopPin, HIGH);
+    http("POST", "/estop/reset");
+    if (!waitForState("FAULT", 2000, false))
+    {
+      failures++;
+      fprintf(stderr, "trip %d: reset did not clear FAULT\n", t);
+    }
+  }
+
+  running = false;
+  for (auto &th : extra)
+    th.join();
+  loopThread.join();
+  server.end();
+
+  const char *names[2] = {"button", "api"};
+  uint32_t bounds[2] = {boundUs, apiBoundUs};
+  for (int k = 0; k < 2; k++)
+  {
+    std::vector<uint32_t> &v = cutUs[k];
+    if (v.empty())
+      continue;
+    std::sort(v.begin(), v.end());
+    printf("%-6s trips %zu  cut p50 %u us  p99 %u us  max %u us  bound %u us\n", names[k], v.size(), v[v.size() / 2],
+           v[v.size() * 99 / 100], v.back(), bounds[k]);
+  }
+  printf("handler entry to cut: max %u us  failures %d\n", cyclesToUs(estopMaxCycles.load()), failures);
+  return failures ? 1 : 0;
+}
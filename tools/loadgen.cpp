@@ -0,0 +1,313 @@
+// HTTP load generator for the bridge controller. Replays the dashboard's
+// polling mix (data/script.js) from many simulated dashboards at once against
+// the host build (tools/bridge_host.cpp) or a real board on the local network.
+//
+//   g++ -std=c++17 -O2 tools/loadgen.cpp -o loadgen -pthread
+//   ./loadgen --host 127.0.0.1 --port 8080 --dashboards 20 --seconds 30
+//
+// Options:
+//   --mix poll       fixed-interval polling (distance 500 ms, state 350 ms,
+//                    lights 250 ms, timers 200 ms), the pre-long-poll UI
+//   --mix longpoll   what script.js does now: /distance polled, status routes
+//                    long-polled with ?since=&wait= (default)
+//   --flood          every stream sends back-to-back, no think time
+//
+// Reports per-route requests/s, p50/p99/p999 latency, error rate and bytes,
+// plus the control-loop tick interval the controller saw during the run
+// (diffed from two /metrics samples).
+#include <arpa/inet.h>
+#include <netdb.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <sys/socket.h>
+#include <sys/time.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <mutex>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+
+using Clock = std::chrono::steady_clock;
+
+static std::string gHost = "127.0.0.1";
+static std::string gPort = "8080";
+
+struct Reply
+{
+  int status = 0;
+  std::string body;
+};
+
+// One request per connection, like the device (it answers Connection: close)
+static bool httpGet(const std::string &path, Reply &out, int timeoutMs)
+{
+  addrinfo hints{}, *res = nullptr;
+  hints.ai_family = AF_INET;
+  hints.ai_socktype = SOCK_STREAM;
+  if (getaddrinfo(gHost.c_str(), gPort.c_str(), &hints, &res) != 0)
+    return false;
+  int fd = socket(res->ai_family, res->ai_socktype, 0);
+  timeval tv{timeoutMs / 1000, (timeoutMs % 1000) * 1000};
+  setsockopt(fd, SOL_SOCKET, SO_RCVTIMEO, &tv, sizeof(tv));
+  setsockopt(fd, SOL_SOCKET, SO_SNDTIMEO, &tv, sizeof(tv));
+  int one = 1;
+  setsockopt(fd, IPPROTO_TCP, TCP_NODELAY, &one, sizeof(one));
+  bool ok = connect(fd, res->ai_addr, res->ai_addrlen) == 0;
+  freeaddrinfo(res);
+  if (ok)
+  {
+    std::string req = "GET " + path + " HTTP/1.1\r\nHost: " + gHost + "\r\nConnection: close\r\n\r\n";
+    ok = send(fd, req.data(), req.size(), MSG_NOSIGNAL) == (ssize_t)req.size();
+  }
+  std::string raw;
+  char buf[4096];
+  ssize_t n;
+  while (ok && (n = recv(fd, buf, sizeof(buf), 0)) > 0)
+    raw.append(buf, n);
+  close(fd);
+  if (!ok || raw.compare(0, 9, "HTTP/1.1 ") != 0)
+    return false;
+  out.status = atoi(raw.c_str() + 9);
+  size_t hdrEnd = raw.find("\r\n\r\n");
+  out.body = hdrEnd == std::string::npos ? std::string() : raw.substr(hdrEnd + 4);
+  if (raw.find("Transfer-Encoding: chunked") != std::string::npos)
+  {
+    // Un-chunk (held long-poll responses)
+    std::string plain;
+    size_t p = 0;
+    while (p < out.body.size())
+    {
+      size_t len = strtoul(out.body.c_str() + p, nullptr, 16);
+      p = out.body.find("\r\n", p);
+      if (len == 0 || p == std::string::npos)
+        break;
+      plain.append(out.body, p + 2, len);
+      p += 2 + len + 2;
+    }
+    out.body = plain;
+  }
+  return true;
+}
+
+static long jsonNumber(const std::string &body, const char *key)
+{
+  std::string k = std::string("\"") + key + "\":";
+  size_t p = body.find(k);
+  return p == std::string::npos ? -1 : atol(body.c_str() + p + k.size());
+}
+
+struct RouteStats
+{
+  std::string name;
+  std::mutex mu;
+  std::vector<uint32_t> latUs;
+  uint64_t errors = 0;
+  uint64_t bytes = 0;
+};
+
+struct Stream
+{
+  RouteStats *stats;
+  std::string path;
+  int gapMs;     // think time between requests
+  bool longPoll; // follow the version like script.js watch()
+};
+
+static std::atomic<bool> gStop(false);
+
+static void runStream(Stream s, unsigned seed)
+{
+  std::mt19937 rng(seed);
+  // Dashboards open at random moments, not in lockstep
+  std::this_thread::sleep_for(std::chrono::milliseconds(s.gapMs ? rng() % (s.gapMs * 2) : 0));
+  long version = -1;
+  std::vector<uint32_t> lat;
+  uint64_t errors = 0, bytes = 0;
+  while (!gStop.load())
+  {
+    std::string path = s.path;
+    if (s.longPoll && version >= 0)
+      path += "?since=" + std::to_string(version) + "&wait=20000";
+    Reply r;
+    auto t0 = Clock::now();
+    bool ok = httpGet(path, r, 30000);
+    auto us = std::chrono::duration_cast<std::chrono::microseconds>(Clock::now() - t0).count();
+    if (gStop.load())
+      break;
+    if (!ok || (r.status != 200 && r.status != 202 && r.status != 304))
+    {
+      errors++;
+      version = -1;
+      std::this_thread::sleep_for(std::chrono::milliseconds(100));
+      continue;
+    }
+    lat.push_back((uint32_t)us);
+    bytes += r.body.size();
+    if (s.longPoll && r.status == 200)
+      version = jsonNumber(r.body, "version");
+    if (s.gapMs)
+      std::this_thread::sleep_for(std::chrono::milliseconds(s.gapMs));
+  }
+  std::lock_guard<std::mutex> g(s.stats->mu);
+  s.stats->latUs.insert(s.stats->latUs.end(), lat.begin(), lat.end());
+  s.stats->errors += errors;
+  s.stats->bytes += bytes;
+}
+
+struct TickSample
+{
+  long count = 0, sumMs = 0, maxMs = 0, bucketMs = 5;
+  std::vector<long> hist;
+};
+
+static bool readTicks(TickSample &t)
+{
+  Reply r;
+  if (!httpGet("/metrics", r, 5000) || r.status != 200)
+    return false;
+  t.count = jsonNumber(r.body, "count");
+  t.sumMs = jsonNumber(r.body, "sum_ms");
+  t.maxMs = jsonNumber(r.body, "max_ms");
+  t.bucketMs = jsonNumber(r.body, "bucket_ms");
+  size_t p = r.body.find("\"hist\":[");
+  if (p == std::string::npos)
+    return false;
+  const char *c = r.body.c_str() + p + 8;
+  while (*c && *c != ']')
+  {
+    t.hist.push_back(strtol(c, (char **)&c, 10));
+    if (*c == ',')
+      c++;
+  }
+  return true;
+}
+
+static double pct(const std::vector<uint32_t> &v, double q)
+{
+  if (v.empty())
+    return 0;
+  size_t i = (size_t)(q * (v.size() - 1));
+  return v[i] / 1000.0;
+}
+
+int main(int argc, char **argv)
+{
+  int dashboards = 10, seconds = 20;
+  std::string mix = "longpoll";
+  bool flood = false;
+  for (int i = 1; i < argc; i++)
+  {
+    std::string a = argv[i];
+    const char *v = i + 1 < argc ? argv[i + 1] : "";
+    if (a == "--host")
+      gHost = v, i++;
+    else if (a == "--port")
+      gPort = v, i++;
+    else if (a == "--dashboards")
+      dashboards = atoi(v), i++;
+    else if (a == "--seconds")
+      seconds = atoi(v), i++;
+    else if (a == "--mix")
+      mix = v, i++;
+    else if (a == "--flood")
+      flood = true;
+    else
+    {
+      fprintf(stderr, "unknown option %s\n", a.c_str());
+      return 1;
+    }
+  }
+  bool longPoll = mix == "longpoll" && !flood;
+
+  RouteStats distance, state, lights, timers;
+  distance.name = "/distance";
+  state.name = "/state";
+  lights.name = "/lights";
+  timers.name = "/timers";
+
+  TickSample before, after;
+  bool haveTicks = readTicks(before);
+
+  std::vector<std::thread> threads;
+  unsigned seed = 1;
+  for (int d = 0; d < dashboards; d++)
+  {
+    std::vector<Stream> streams;
+    if (longPoll)
+      streams = {{&distance, "/distance", 500, false},
+                 {&state, "/state", 100, true},
+                 {&lights, "/lights", 100, true},
+                 {&timers, "/timers", 200, true}};
+    else
+      streams = {{&distance, "/distance", 500, false},
+                 {&state, "/state", 350, false},
+                 {&lights, "/lights", 250, false},
+                 {&timers, "/timers", 200, false}};
+    for (auto &s : streams)
+    {
+      if (flood)
+        s.gapMs = 0;
+      threads.emplace_back(runStream, s, seed++);
+    }
+  }
+
+  std::this_thread::sleep_for(std::chrono::seconds(seconds));
+  gStop = true;
+  for (auto &t : threads)
+    t.join();
+  haveTicks = haveTicks && readTicks(after);
+
+  printf("%d dashboards, %d s, mix=%s%s, target %s:%s\n", dashboards, seconds, longPoll ? "longpoll" : "poll",
+         flood ? " (flood)" : "", gHost.c_str(), gPort.c_str());
+  printf("%-10s %8s %8s %8s %8s %8s %7s %9s\n", "route", "reqs", "req/s", "p50 ms", "p99 ms", "p999 ms", "err %",
+         "B/req");
+  uint64_t totalReqs = 0, totalErr = 0, totalBytes = 0;
+  for (RouteStats *r : {&distance, &state, &lights, &timers})
+  {
+    std::sort(r->latUs.begin(), r->latUs.end());
+    size_t n = r->latUs.size();
+    totalReqs += n;
+    totalErr += r->errors;
+    totalBytes += r->bytes;
+    printf("%-10s %8zu %8.1f %8.2f %8.2f %8.2f %7.2f %9.1f\n", r->name.c_str(), n, (double)n / seconds,
+           pct(r->latUs, 0.50), pct(r->latUs, 0.99), pct(r->latUs, 0.999),
+           n + r->errors ? 100.0 * r->errors / (n + r->errors) : 0.0, n ? (double)r->bytes / n : 0.0);
+  }
+  printf("%-10s %8llu %8.1f %35.2f %9.1f\n", "total", (unsigned long long)totalReqs, (double)totalReqs / seconds,
+         totalReqs + totalErr ? 100.0 * totalErr / (totalReqs + totalErr) : 0.0,
+         totalReqs ? (double)totalBytes / totalReqs : 0.0);
+  if (longPoll)
+    printf("(status route latencies include time a long-poll was held waiting for a change)\n");
+
+  if (!haveTicks || after.hist.size() != before.hist.size())
+  {
+    printf("control loop: /metrics not available\n");
+    return totalErr ? 1 : 0;
+  }
+  long ticks = after.count - before.count;
+  std::vector<long> h(after.hist.size());
+  for (size_t i = 0; i < h.size(); i++)
+    h[i] = after.hist[i] - before.hist[i];
+  auto histPct = [&](double q) {
+    long want = (long)(q * ticks), seen = 0;
+    for (size_t i = 0; i < h.size(); i++)
+      if ((seen += h[i]) > want)
+        return (long)((i + 1) * after.bucketMs);
+    return (long)(h.size() * after.bucketMs);
+  };
+  long maxBucket = 0;
+  for (size_t i = 0; i < h.size(); i++)
+    if (h[i])
+      maxBucket = (long)((i + 1) * after.bucketMs);
+  printf("control loop: %ld ticks, interval mean %.1f ms, p50 <%ld ms, p99 <%ld ms, max <%ld ms\n", ticks,
+         ticks ? (double)(after.sumMs - before.sumMs) / ticks : 0.0, histPct(0.50), histPct(0.99), maxBucket);
+  return 0;
+}
@@ -0,0 +1,461 @@
+// Microbenchmarks of the controller's per-tick and per-request functions,
+// run in-process against the host stand-ins (no sockets, no real time):
+// distance conversion, one state-machine step per MotorState held in that
+// state, the lamp helpers, stateString, the status publish and every JSON
+// route through the firmware's route table.
+//
+//   g++ -std=c++17 -O2 -Ihost tools/micro_bench.cpp -o micro_bench -pthread
+//   ./micro_bench --save bench.base          # record a baseline ...
+//   ./micro_bench --add bench.base           # ... from a few runs
+//   ./micro_bench --compare bench.base       # exits 1 on a regression
+//
+// Options:
+//   --filter S      only cases whose name contains S
+//   --samples N     timed samples per case (default 15)
+//   --sample-ms N   target length of one sample (default 10)
+//   --save FILE     write the results as a baseline
+//   --add FILE      add the results to a baseline as one more run
+//   --compare FILE  compare against a baseline; a case regresses when its
+//                   median is slower by more than its limit and the floor
+//   --threshold P   smallest limit, percent (default 10)
+//   --noise-k K     the limit is at least K times the noise of the
+//                   difference (default 3)
+//   --run-threshold P  percent the whole run may be slower (default 15)
+//   --floor-ns N    differences smaller than this never count (default 2)
+//   --retries N     re-sample cases over their limit up to N more times
+//                   before calling them regressions (default 2)
+//
+// Each case is repeated until one sample takes --sample-ms of thread CPU
+// time. Then all cases are sampled in turn, --samples rounds, and a case's
+// result is its median sample. A compare run checks that median against the
+// baseline's, like with like.
+//
+// Within one run the median barely moves (well under 1%), but from one
+// process to the next a case can land 10-20% either way: code and heap
+// layout, and the machine's clock. So a baseline holds one line per case
+// per run, and with three runs or more a case's noise is the spread of its
+// run medians (median absolute deviation); with fewer, only the in-run
+// spread is known. A case's limit is the threshold, or K times the noise of
+// the difference if that is more, so a case that wobbles needs a bigger
+// change to count. A case over its limit is sampled again and judged on all
+// its samples, so a slow spell on the machine clears on a retry.
+//
+// A busy machine slows every case at once, by up to 12% here for minutes on
+// end, which no retry clears. With BENCH_SHIFT_CASES cases or more, each is
+// judged against the baseline scaled by the whole run's shift (the median
+// case's change), and the shift itself regresses over --run-threshold. A
+// change that slows one path stands out; one that slows everything needs
+// the bigger threshold. Against a five-run baseline, a case of 20 ns or
+// more that got 25% slower was caught 52 times in 54, 15% about half the
+// time, 10% hardly ever (README). Baselines are only comparable on the same
+// machine and compiler flags.
+#include "../src/main.cpp"
+
+#include <algorithm>
+#include <functional>
+#include <map>
+#include <string>
+#include <time.h>
+
+struct BenchCase
+{
+  std::string name;
+  std::function<void()> prep; // before each sample, untimed
+  std::function<void()> op;   // the timed operation
+};
+
+struct BenchResult
+{
+  double minNs;
+  double medianNs;
+  double noisePct; // standard error of the median, percent of it
+};
+
+// One case's lines in a baseline file, one per run
+struct BenchBaseline
+{
+  std::vector<double> medianNs;
+  std::vector<double> noisePct;
+};
+
+const size_t BENCH_SHIFT_CASES = 8; // fewer compared: no run shift
+
+static volatile uintptr_t benchSink; // keeps results from being optimized away
+
+// Thread CPU time: time the scheduler gives to other processes is not ours
+static double cpuNs()
+{
+  timespec ts;
+  clock_gettime(CLOCK_THREAD_CPUTIME_ID, &ts);
+  return ts.tv_sec * 1e9 + ts.tv_nsec;
+}
+
+static double timeOp(const BenchCase &c, long iters)
+{
+  if (c.prep)
+    c.prep();
+  double t0 = cpuNs();
+  for (long i = 0; i < iters; i++)
+    c.op();
+  return cpuNs() - t0;
+}
+
+static long calibrate(const BenchCase &c, double sampleNs)
+{
+  long iters = 1;
+  while (timeOp(c, iters) < sampleNs && iters < (1L << 30))
+    iters *= 2;
+  return iters;
+}
+
+// Rounds of one sample per case, so a busy spell on the machine lands on
+// every case a little instead of on a few cases a lot
+static void sampleRounds(const std::vector<BenchCase> &cases, const std::vector<long> &iters,
+                         const std::vector<size_t> &which, int samples, std::vector<std::vector<double>> &perOp)
+{
+  for (int s = 0; s < samples; s++)
+    for (size_t i : which)
+      perOp[i].push_back(timeOp(cases[i], iters[i]) / iters[i]);
+}
+
+static double medianOf(std::vector<double> v)
+{
+  std::sort(v.begin(), v.end());
+  return v[v.size() / 2];
+}
+
+// Sigma of v as a percent of its median; MAD x 1.4826 estimates it without
+// the slow outliers
+static double sigmaPct(const std::vector<double> &v)
+{
+  double median = medianOf(v);
+  std::vector<double> dev;
+  for (double x : v)
+    dev.push_back(fabs(x - median));
+  return median > 0 ? medianOf(dev) * 1.4826 * 100 / median : 0;
+}
+
+static BenchResult summarize(const std::vector<double> &perOp)
+{
+  // The median of n samples varies by about 1.25 sigma / sqrt(n)
+  return {*std::min_element(perOp.begin(), perOp.end()), medianOf(perOp),
+          1.2533 * sigmaPct(perOp) / sqrt((double)perOp.size())};
+}
+
+static AsyncWebServerRequest makeRequest(WebRequestMethodComposite method, const char *url,
+                                         const char *param = nullptr, const char *value = nullptr)
+{
+  AsyncWebServerRequest req;
+  req.method_ = method;
+  req.url_ = url;
+  if (param)
+    req.params_.push_back(AsyncWebParameter(param, value, false));
+  return req;
+}
+
+// A GET route as the dashboard calls it; the response is built and dropped
+static BenchCase routeCase(const char *url, const char *param = nullptr, const char *value = nullptr)
+{
+  std::string name = std::string("GET ") + url;
+  if (param)
+    name += std::string("?") + param + "=" + value;
+  std::shared_ptr<AsyncWebServerRequest> req =
+      std::make_shared<AsyncWebServerRequest>(makeRequest(HTTP_GET, url, param, value));
+  return {name, nullptr, [req] {
+            server.dispatch(req.get());
+            benchSink = (uintptr_t)req->response_->body.size();
+          }};
+}
+
+// A command route: handler and its JSON reply, then the loop applying it
+static BenchCase commandCase(const char *url, const char *param, const char *value)
+{
+  std::string name = std::string("POST ") + url + "?" + param + "=" + value + " +drain";
+  std::shared_ptr<AsyncWebServerRequest> req =
+      std::make_shared<AsyncWebServerRequest>(makeRequest(HTTP_POST, url, param, value));
+  return {name, nullptr, [req] {
+            server.dispatch(req.get());
+            drainCommands(millis());
+            benchSink = (uintptr_t)req->response_->code;
+          }};
+}
+
+// One step held in state s: inputs keep the machine from moving on, so every
+// step is the per-tick cost of that state and not of a transition
+static BenchCase stateCase(MotorState s, float distanceCm)
+{
+  return {std::string("step ") + stateString(s),
+          [s, distanceCm] {
+            unsigned long now = millis();
+            estopLatched = ESTOP_NONE;
+            // In motion whatever the clock did since: never updated, so it stays so
+            moveDeck(deck.position() == DECK_OPEN ? DECK_CLOSED : DECK_OPEN, now);
+            currentState = s;
+            yellowStartTime = now;
+            boatClearTime = 0;
+            distanceA = distanceB = distanceCm;
+          },
+          [s] {
+            stepStateMachine(millis());
+            benchSink = (uintptr_t)currentState;
+            currentState = s;
+          }};
+}
+
+static std::vector<BenchCase> allCases()
+{
+  std::vector<BenchCase> cases;
+
+  // Sensing
+  hostEchoModel = [](int) { return 5882UL; }; // 100 cm
+  cases.push_back({"getDistance", nullptr, [] {
+                     float d = getDistance(trigPin_A, echoPin_A);
+                     benchSink = (uintptr_t)d;
+                   }});
+  cases.push_back({"echoToCm", nullptr, [] {
+                     static long echo = 0;
+                     echo = (echo + 977) % 30000;
+                     benchSink = (uintptr_t)echoToCm(echo);
+                   }});
+
+  // State machine
+  cases.push_back(stateCase(IDLE, 400));
+  cases.push_back(stateCase(ROAD_WARNING, 50));
+  cases.push_back(stateCase(BOAT_WARNING, 50));
+  cases.push_back(stateCase(BRIDGE_OPENING, 50));
+  cases.push_back(stateCase(BRIDGE_OPEN, 50));
+  cases.push_back(stateCase(BRIDGE_CLOSING, 400));
+  cases.push_back(stateCase(FAULT, 400));
+
+  // Lamps: the usual tick sets what is already shown; the change path traces
+  cases.push_back({"setLights", nullptr, [] { setLights(true, false, false, true, false, false); }});
+  cases.push_back({"setLights (change)", nullptr, [] {
+                     static bool flip = false;
+                     flip = !flip;
+                     setLights(flip, !flip, false, !flip, false, flip);
+                   }});
+  cases.push_back({"applyRoad", nullptr, [] { applyRoad(LAMP_ON, LAMP_OFF, LAMP_OFF); }});
+  cases.push_back({"applyBoat", nullptr, [] { applyBoat(LAMP_ON, LAMP_WARN_FLASH, LAMP_OFF); }});
+  cases.push_back({"applyBoat (change)", nullptr, [] {
+                     static bool flip = false;
+                     flip = !flip;
+                     applyBoat(LAMP_ON, flip ? LAMP_WARN_FLASH : LAMP_OFF, LAMP_OFF);
+                   }});
+  cases.push_back({"stateString", nullptr, [] {
+                     static int s = 0;
+                     s = (s + 1) % (FAULT + 1);
+                     benchSink = (uintptr_t)stateString((MotorState)s);
+                   }});
+
+  // Status bodies, built by the loop for the routes below
+  cases.push_back({"publishStatus", nullptr, [] { publishStatus(millis()); }});
+
+  // Routes
+  for (const char *url : {"/state", "/lights", "/timers", "/distance", "/road", "/mode", "/reservations",
+                          "/telemetry", "/corridor", "/capture/status", "/metrics"})
+    cases.push_back(routeCase(url));
+  cases.push_back(routeCase("/cmd", "seq", "1"));
+  cases.push_back(routeCase("/state", "since", "0"));
+  cases.push_back(commandCase("/mode", "value", "auto"));
+  cases.push_back(commandCase("/reservations/cancel", "id", "7"));
+  return cases;
+}
+
+static bool loadBaseline(const char *path, std::map<std::string, BenchBaseline> &base)
+{
+  FILE *f = fopen(path, "r");
+  if (!f)
+    return false;
+  char line[256];
+  while (fgets(line, sizeof(line), f))
+  {
+    if (line[0] == '#')
+      continue;
+    char *tab = strchr(line, '\t');
+    if (tab)
+    {
+      *tab = 0;
+      char *end;
+      BenchBaseline &b = base[line];
+      b.medianNs.push_back(strtod(tab + 1, &end));
+      b.noisePct.push_back(strtod(end, nullptr)); // older baselines: no noise column, 0
+    }
+  }
+  fclose(f);
+  return true;
+}
+
+int main(int argc, char **argv)
+{
+  std::string filter;
+  int samples = 15;
+  int retries = 2;
+  double sampleMs = 10, threshold = 10, floorNs = 2, noiseK = 3, runThreshold = 15;
+  const char *savePath = nullptr, *comparePath = nullptr;
+  bool add = false;
+  for (int i = 1; i < argc; i++)
+  {
+    std::string a = argv[i];
+    const char *v = i + 1 < argc ? argv[i + 1] : "";
+    if (a == "--filter")
+      filter = v, i++;
+    else if (a == "--samples")
+      samples = atoi(v), i++;
+    else if (a == "--sample-ms")
+      sampleMs = atof(v), i++;
+    else if (a == "--save")
+      savePath = v, add = false, i++;
+    else if (a == "--add")
+      savePath = v, add = true, i++;
+    else if (a == "--compare")
+      comparePath = v, i++;
+    else if (a == "--threshold")
+      threshold = atof(v), i++;
+    else if (a == "--run-threshold")
+      runThreshold = atof(v), i++;
+    else if (a == "--floor-ns")
+      floorNs = atof(v), i++;
+    else if (a == "--noise-k")
+      noiseK = atof(v), i++;
+    else if (a == "--retries")
+      retries = atoi(v), i++;
+    else
+    {
+      fprintf(stderr, "unknown option %s\n", a.c_str());
+      return 1;
+    }
+  }
+  if (samples < 1 || sampleMs <= 0)
+  {
+    fprintf(stderr, "bad arguments\n");
+    return 1;
+  }
+  std::map<std::string, BenchBaseline> base;
+  if (comparePath && !loadBaseline(comparePath, base))
+  {
+    perror(comparePath);
+    return 1;
+  }
+
+  hostSerialQuiet = true;
+  hostVirtualTime = true; // the echo wait is the sensor's time, not CPU
+  hostWiFiConnectMs = -1; // no server thread: this thread is the only caller
+  setup();
+  setupRoutes();
+  publishStatus(millis());
+
+  FILE *save = savePath ? fopen(savePath, add ? "a" : "w") : nullptr;
+  if (savePath && !save)
+  {
+    perror(savePath);
+    return 1;
+  }
+  if (save && ftell(save) == 0)
+    fprintf(save, "# micro_bench baseline, a line per case per run: case<TAB>median ns/op<TAB>noise %%\n");
+
+  std::vector<BenchCase> cases;
+  for (BenchCase &c : allCases())
+    if (filter.empty() || c.name.find(filter) != std::string::npos)
+      cases.push_back(c);
+  std::vector<long> iters;
+  for (const BenchCase &c : cases)
+    iters.push_back(calibrate(c, sampleMs * 1e6));
+  std::vector<size_t> all;
+  for (size_t i = 0; i < cases.size(); i++)
+    all.push_back(i);
+  std::vector<std::vector<double>> perOp(cases.size());
+  sampleRounds(cases, iters, all, samples, perOp);
+
+  // Percent a case may be slower before it counts: K sigma of the
+  // difference between this run's median and the baseline's
+  auto limit = [&](size_t i) {
+    const BenchBaseline &b = base[cases[i].name];
+    double run = summarize(perOp[i]).noisePct, saved = medianOf(b.noisePct);
+    double noise = sqrt(saved * saved + run * run);
+    size_t runs = b.medianNs.size();
+    if (runs >= 3)
+    {
+      // This run is one more draw from the runs' spread; the baseline is
+      // their median
+      double between = sigmaPct(b.medianNs) * sqrt(1 + 1.5708 / runs);
+      noise = std::max(noise, between);
+    }
+    return std::max(threshold, noiseK * noise);
+  };
+  // The whole run's speed against the baseline's: the median case's ratio
+  auto runShift = [&] {
+    std::vector<double> ratios;
+    for (size_t i = 0; i < cases.size(); i++)
+    {
+      auto it = base.find(cases[i].name);
+      if (it != base.end())
+        ratios.push_back(summarize(perOp[i]).medianNs / medianOf(it->second.medianNs));
+    }
+    return ratios.size() >= BENCH_SHIFT_CASES ? medianOf(ratios) : 1.0;
+  };
+  // Baseline median of case i, scaled to this run's speed
+  auto expected = [&](size_t i, double shift) { return medianOf(base[cases[i].name].medianNs) * shift; };
+  // A slow spell on the machine can outlast a whole pass. Cases over their
+  // limit are sampled again, and only count if they stay over.
+  auto over = [&](size_t i) {
+    if (!base.count(cases[i].name))
+      return false;
+    double ns = summarize(perOp[i]).medianNs, was = expected(i, runShift());
+    return ns - was > floorNs && ns > was * (1 + limit(i) / 100);
+  };
+  std::vector<int> retried(cases.size(), 0);
+  for (int attempt = 0; comparePath && attempt < retries; attempt++)
+  {
+    std::vector<size_t> again;
+    for (size_t i = 0; i < cases.size(); i++)
+      if (over(i))
+        again.push_back(i);
+    if (again.empty())
+      break;
+    for (size_t i : again)
+      retried[i]++;
+    sampleRounds(cases, iters, again, samples, perOp);
+  }
+
+  int regressions = 0;
+  double shift = runShift();
+  printf("%-36s %10s %10s %6s", "case", "median", "min", "noise");
+  if (comparePath)
+    printf(" %10s %8s %6s", "baseline", "change", "limit");
+  printf("\n");
+  for (size_t i = 0; i < cases.size(); i++)
+  {
+    const BenchCase &c = cases[i];
+    BenchResult r = summarize(perOp[i]);
+    printf("%-36s %10.1f %10.1f %5.1f%%", c.name.c_str(), r.medianNs, r.minNs, r.noisePct);
+    if (save)
+      fprintf(save, "%s\t%.2f\t%.2f\n", c.name.c_str(), r.medianNs, r.noisePct);
+    if (comparePath)
+    {
+      auto it = base.find(c.name);
+      if (it == base.end())
+        printf(" %10s %8s %6s", "-", "new", "-");
+      else
+      {
+        double was = expected(i, shift);
+        double change = was > 0 ? (r.medianNs - was) * 100 / was : 0;
+        bool regressed = over(i);
+        printf(" %10.1f %+7.1f%% %5.1f%%%s", was, change, limit(i),
+               regressed ? "  REGRESSION" : (retried[i] ? "  (noise, retried)" : ""));
+        regressions += regressed;
+      }
+    }
+    printf("\n");
+  }
+  if (save)
+    fclose(save);
+  if (comparePath)
+  {
+    bool slow = (shift - 1) * 100 > runThreshold;
+    printf("whole run %+.1f%% against the baseline%s; baseline column scaled by that\n", (shift - 1) * 100,
+           slow ? "  REGRESSION" : "");
+    regressions += slow;
+    printf("%d regression%s over %.0f%% or the noise\n", regressions, regressions == 1 ? "" : "s", threshold);
+  }
+  return regressions ? 1 : 0;
+}
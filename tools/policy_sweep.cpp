@@ -0,0 +1,391 @@
+// Parallel parameter sweep over the bridge timing policy. Runs many
+// independent simulated deployments (tools/traffic_sim.h) across all host
+// cores and prints the Pareto front of road downtime against boat wait.
+//
+//   g++ -std=c++17 -O2 -Ihost tools/policy_sweep.cpp -o policy_sweep -pthread
+//   ./policy_sweep --param clear-window-ms=2000:10000:2000 --param detect-cm=30:50:10
+//   ./policy_sweep --random 200 --param road-warning-ms=1000:5000 --param clear-window-ms=1000:12000
+//
+// Sweep options:
+//   --param NAME=LO:HI[:STEP]  swept policy knob (repeatable). NAME is one of
+//                              road-warning-ms, boat-warning-ms,
+//                              clear-window-ms, detect-cm, clear-cm. Grid
+//                              mode needs STEP; knobs not given keep the
+//                              firmware defaults.
+//   --random N                 N points drawn uniformly from the ranges
+//                              instead of the grid
+//   --sweep-seed N             seed for --random (default 1)
+//   --reps K                   traffic seeds per point, seed..seed+K-1, shared
+//                              by every point (default 2)
+//   --jobs N                   simulations in flight (default: all cores)
+//   --wait mean|p95            boat-wait KPI for the front (default mean)
+//   --csv FILE                 every point's KPIs as CSV
+// plus all traffic options of tools/traffic_sim.cpp (--days defaults to 1).
+//
+// The firmware keeps its state in globals, one controller per process, so
+// each simulation runs in its own fork()ed process, started from a parent
+// that never ran setup(). A free slot takes the next job as soon as a
+// simulation ends, which balances uneven run times the way a work-stealing
+// pool would. Results come back through shared memory.
+//
+// Points with any conflict (a boat under a deck that was not fully open)
+// are unsafe and never make the front.
+#include "traffic_sim.h"
+
+#include <sys/mman.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+#include <chrono>
+#include <ctime>
+#include <map>
+#include <thread>
+
+struct ParamDef
+{
+  const char *name;
+  double def;
+};
+
+const ParamDef PARAMS[] = {
+    {"road-warning-ms", 3000}, {"boat-warning-ms", 3000}, {"clear-window-ms", 6000}, {"detect-cm", 50}, {"clear-cm", 70},
+};
+const int PARAM_COUNT = sizeof(PARAMS) / sizeof(PARAMS[0]);
+
+void applyParams(const double *v)
+{
+  ROAD_WARNING_MS = (unsigned long)v[0];
+  BOAT_WARNING_MS = (unsigned long)v[1];
+  CLEAR_WINDOW_MS = (unsigned long)v[2];
+  DETECT_CM = (float)v[3];
+  CLEAR_CM = (float)v[4];
+}
+
+struct ParamRange
+{
+  double lo, hi, step;
+};
+
+// Boat waits come back as a histogram so reps can be pooled for the p95
+const int WAIT_BINS = 7200;
+const double WAIT_BIN_S = 0.5; // up to an hour; the last bin is open-ended
+
+struct JobResult
+{
+  int done;
+  double hours;
+  double roadClosedMin;
+  int openings;
+  int falseOpenings;
+  int conflicts;
+  long boats;
+  double waitSum;
+  double waitMax;
+  double cpuS;
+  uint32_t waitHist[WAIT_BINS];
+};
+
+struct Point
+{
+  double v[PARAM_COUNT];
+  double roadMinPerDay, waitMean, waitP95, waitMax, openingsPerHour;
+  int falseOpenings, conflicts;
+  long boats;
+};
+
+static double nowS()
+{
+  return std::chrono::duration<double>(std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+// Child side: one simulated deployment
+static void runJob(const SimConfig &cfg, const double *v, JobResult &out)
+{
+  std::clock_t c0 = std::clock();
+  applyParams(v);
+  TrafficSim sim(cfg);
+  sim.begin();
+  for (int d = 0; d < cfg.days; d++)
+  {
+    DayKpi k = sim.runDay();
+    out.roadClosedMin += k.roadClosedMs / 60000.0;
+    out.openings += k.openings;
+    out.falseOpenings += k.falseOpenings;
+    out.conflicts += k.conflicts;
+    out.boats += (long)k.waitsS.size();
+    for (double w : k.waitsS)
+    {
+      out.waitSum += w;
+      out.waitMax = std::max(out.waitMax, w);
+      out.waitHist[std::min(WAIT_BINS - 1, (int)(w / WAIT_BIN_S))]++;
+    }
+  }
+  out.hours = cfg.days * cfg.dayHours;
+  out.cpuS = (double)(std::clock() - c0) / CLOCKS_PER_SEC;
+  out.done = 1;
+}
+
+static bool parseParam(const char *s, std::map<int, ParamRange> &ranges)
+{
+  const char *eq = strchr(s, '=');
+  if (!eq)
+    return false;
+  std::string name(s, eq - s);
+  for (int p = 0; p < PARAM_COUNT; p++)
+  {
+    if (name != PARAMS[p].name)
+      continue;
+    ParamRange r = {0, 0, 0};
+    int n = sscanf(eq + 1, "%lf:%lf:%lf", &r.lo, &r.hi, &r.step);
+    if (n < 2 || r.hi < r.lo || r.lo < 0 || (n == 3 && r.step <= 0))
+      return false;
+    ranges[p] = r;
+    return true;
+  }
+  return false;
+}
+
+int main(int argc, char **argv)
+{
+  SimConfig cfg;
+  std::map<int, ParamRange> ranges;
+  int randomPoints = 0, reps = 2;
+  uint32_t sweepSeed = 1;
+  int jobs = (int)std::max(1u, std::thread::hardware_concurrency());
+  bool p95 = false;
+  const char *csvPath = nullptr;
+  for (int i = 1; i < argc; i++)
+  {
+    std::string a = argv[i];
+    const char *v = i + 1 < argc ? argv[i + 1] : "";
+    int r = parseSimOption(a, v, cfg, i);
+    bool ok = r > 0;
+    if (r == 0)
+    {
+      ok = true;
+      if (a == "--param")
+        ok = parseParam(v, ranges), i++;
+      else if (a == "--random")
+        randomPoints = atoi(v), i++;
+      else if (a == "--sweep-seed")
+        sweepSeed = (uint32_t)strtoul(v, nullptr, 10), i++;
+      else if (a == "--reps")
+        reps = atoi(v), i++;
+      else if (a == "--jobs")
+        jobs = atoi(v), i++;
+      else if (a == "--wait")
+        ok = (p95 = std::string(v) == "p95") || std::string(v) == "mean", i++;
+      else if (a == "--csv")
+        csvPath = v, i++;
+      else
+        ok = false;
+    }
+    if (!ok)
+    {
+      fprintf(stderr, "bad option %s %s\n", a.c_str(), v);
+      return 1;
+    }
+  }
+  if (!validSimConfig(cfg))
+    return 1;
+  if (ranges.empty() || reps < 1 || jobs < 1)
+  {
+    fprintf(stderr, "need at least one --param, reps >= 1 and jobs >= 1\n");
+    return 1;
+  }
+
+  // Points: the grid, or random draws from the ranges
+  std::vector<Point> points;
+  Point base = {};
+  for (int p = 0; p < PARAM_COUNT; p++)
+    base.v[p] = PARAMS[p].def;
+  if (randomPoints > 0)
+  {
+    std::mt19937 rng(sweepSeed);
+    for (int n = 0; n < randomPoints; n++)
+    {
+      Point pt = base;
+      for (auto &r : ranges)
+        pt.v[r.first] = std::uniform_real_distribution<double>(r.second.lo, r.second.hi)(rng);
+      points.push_back(pt);
+    }
+  }
+  else
+  {
+    points.push_back(base);
+    for (auto &r : ranges)
+    {
+      if (r.second.step <= 0)
+      {
+        fprintf(stderr, "grid mode needs LO:HI:STEP for %s\n", PARAMS[r.first].name);
+        return 1;
+      }
+      std::vector<Point> next;
+      for (auto &pt : points)
+        for (double x = r.second.lo; x <= r.second.hi + 1e-9; x += r.second.step)
+        {
+          Point q = pt;
+          q.v[r.first] = x;
+          next.push_back(q);
+        }
+      points.swap(next);
+    }
+  }
+
+  // One job per (point, rep); results land in shared memory
+  size_t jobCount = points.size() * reps;
+  size_t bytes = jobCount * sizeof(JobResult);
+  JobResult *results = (JobResult *)mmap(nullptr, bytes, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_ANONYMOUS, -1, 0);
+  if (results == MAP_FAILED)
+  {
+    perror("mmap");
+    return 1;
+  }
+  memset(results, 0, bytes);
+  fflush(stdout);
+
+  fprintf(stderr, "%zu points x %d reps = %zu simulations of %d day(s), %d in flight\n", points.size(), reps,
+          jobCount, cfg.days, jobs);
+  double t0 = nowS();
+  size_t nextJob = 0, finished = 0;
+  int running = 0;
+  while (finished < jobCount)
+  {
+    while (running < jobs && nextJob < jobCount)
+    {
+      size_t j = nextJob++;
+      pid_t pid = fork();
+      if (pid < 0)
+      {
+        perror("fork");
+        return 1;
+      }
+      if (pid == 0)
+      {
+        SimConfig c = cfg;
+        c.seed = cfg.seed + (uint32_t)(j % reps);
+        runJob(c, points[j / reps].v, results[j]);
+        _exit(0);
+      }
+      running++;
+    }
+    int status;
+    if (wait(&status) > 0)
+    {
+      running--;
+      finished++;
+      if (!WIFEXITED(status) || WEXITSTATUS(status) != 0)
+        fprintf(stderr, "a simulation died (status %d)\n", status);
+      if (finished % 50 == 0 || finished == jobCount)
+        fprintf(stderr, "\r%zu/%zu", finished, jobCount);
+    }
+  }
+  double wall = nowS() - t0;
+  fprintf(stderr, "\n");
+
+  // Pool the reps of each point
+  double busy = 0;
+  for (size_t p = 0; p < points.size(); p++)
+  {
+    Point &pt = points[p];
+    double hours = 0, roadMin = 0, waitSum = 0, waitMax = 0;
+    int openings = 0, falseOpenings = 0, conflicts = 0;
+    long boats = 0;
+    uint32_t hist[WAIT_BINS] = {};
+    for (int r = 0; r < reps; r++)
+    {
+      JobResult &j = results[p * reps + r];
+      if (!j.done)
+        conflicts += 1000000; // lost simulation: keep the point off the front
+      busy += j.cpuS;
+      hours += j.hours;
+      roadMin += j.roadClosedMin;
+      openings += j.openings;
+      falseOpenings += j.falseOpenings;
+      conflicts += j.conflicts;
+      boats += j.boats;
+      waitSum += j.waitSum;
+      waitMax = std::max(waitMax, j.waitMax);
+      for (int b = 0; b < WAIT_BINS; b++)
+        hist[b] += j.waitHist[b];
+    }
+    pt.roadMinPerDay = hours > 0 ? roadMin / (hours / 24.0) : 0;
+    pt.openingsPerHour = hours > 0 ? openings / hours : 0;
+    pt.falseOpenings = falseOpenings;
+    pt.conflicts = conflicts;
+    pt.boats = boats;
+    pt.waitMean = boats ? waitSum / boats : 0;
+    pt.waitMax = waitMax;
+    pt.waitP95 = 0;
+    long seen = 0, want = (long)std::ceil(0.95 * boats);
+    for (int b = 0; b < WAIT_BINS && boats; b++)
+      if ((seen += hist[b]) >= want)
+      {
+        pt.waitP95 = (b + 1) * WAIT_BIN_S;
+        break;
+      }
+  }
+
+  if (csvPath)
+  {
+    FILE *f = fopen(csvPath, "w");
+    if (!f)
+    {
+      perror(csvPath);
+      return 1;
+    }
+    for (int p = 0; p < PARAM_COUNT; p++)
+      fprintf(f, "%s,", PARAMS[p].name);
+    fprintf(f, "road_closed_min_day,boat_wait_mean_s,boat_wait_p95_s,boat_wait_max_s,openings_h,false_open,"
+               "conflicts,boats\n");
+    for (auto &pt : points)
+    {
+      for (int p = 0; p < PARAM_COUNT; p++)
+        fprintf(f, "%.0f,", pt.v[p]);
+      fprintf(f, "%.1f,%.2f,%.1f,%.1f,%.2f,%d,%d,%ld\n", pt.roadMinPerDay, pt.waitMean, pt.waitP95, pt.waitMax,
+              pt.openingsPerHour, pt.falseOpenings, pt.conflicts, pt.boats);
+    }
+    fclose(f);
+  }
+
+  // Pareto front: minimise road downtime and boat wait, safe points only
+  auto wait = [p95](const Point &pt) { return p95 ? pt.waitP95 : pt.waitMean; };
+  std::vector<const Point *> safe;
+  for (auto &pt : points)
+    if (pt.conflicts == 0)
+      safe.push_back(&pt);
+  std::sort(safe.begin(), safe.end(), [&](const Point *a, const Point *b) {
+    return a->roadMinPerDay != b->roadMinPerDay ? a->roadMinPerDay < b->roadMinPerDay : wait(*a) < wait(*b);
+  });
+  std::vector<const Point *> front;
+  for (const Point *pt : safe)
+    if (front.empty() || wait(*pt) < wait(*front.back()))
+      front.push_back(pt);
+
+  printf("Pareto front (road downtime vs boat wait %s), %zu of %zu points, %zu unsafe\n", p95 ? "p95" : "mean",
+         front.size(), points.size(), points.size() - safe.size());
+  for (int p = 0; p < PARAM_COUNT; p++)
+    if (ranges.count(p))
+      printf("%16s", PARAMS[p].name);
+  printf(" %10s %10s %9s %9s %11s %10s\n", "road_min/d", "wait_mean", "wait_p95", "wait_max", "openings_h",
+         "false_open");
+  for (const Point *pt : front)
+  {
+    for (int p = 0; p < PARAM_COUNT; p++)
+      if (ranges.count(p))
+        printf("%16.0f", pt->v[p]);
+    printf(" %10.1f %10.2f %9.1f %9.1f %11.2f %10d\n", pt->roadMinPerDay, pt->waitMean, pt->waitP95, pt->waitMax,
+           pt->openingsPerHour, pt->falseOpenings);
+  }
+
+  // Linear scaling shows as sims/s per core staying put as --jobs grows, and
+  // as simulation CPU time filling the cores (the efficiency figure)
+  int cores = std::min(jobs, (int)std::max(1u, std::thread::hardware_concurrency()));
+  double simDays = (double)jobCount * cfg.days * cfg.dayHours / 24.0;
+  printf("\n%zu simulations in %.1f s, %d in flight on %d core(s): %.2f sims/s, %.3f sims/s per core,"
+         " %.1f simulated days/s, parallel efficiency %.0f%%\n",
+         jobCount, wall, jobs, cores, jobCount / wall, jobCount / wall / cores, simDays / wall,
+         100.0 * busy / (wall * cores));
+  munmap(results, bytes);
+  return 0;
+}
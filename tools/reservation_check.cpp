@@ -0,0 +1,208 @@
+// Checks booked openings (POST /reservations) in virtual time.
+//
+//   g++ -std=c++17 -O2 -Ihost tools/reservation_check.cpp -o reservation_check -pthread
+//   ./reservation_check [--tolerance-ms N]
+//
+// Scenarios, each from an idle bridge with no boats unless stated:
+//   single   one booking: the deck is fully open at the booked time and
+//            closes once the hold and the clear window are over;
+//   merged   two bookings with a gap too short to close and reopen: one
+//            opening covers both;
+//   apart    two bookings far apart: two openings;
+//   cancel   a booking cancelled before it is due: no opening;
+//   boat     a boat arrives shortly before a booking: one opening, held
+//            until the booking ends;
+//   late     a booking closer than the lead time: opens as soon as it can.
+//
+// Exits 1 if any scenario opens at the wrong time or the wrong number of
+// times.
+#include "../src/main.cpp"
+
+#include <vector>
+
+static unsigned long boatFromMs = 0, boatToMs = 0;
+
+// Runs a request through the routes; returns the body
+static std::string call(WebRequestMethodComposite method, const char *url,
+                        std::vector<std::pair<const char *, std::string>> params = {})
+{
+  AsyncWebServerRequest req;
+  req.method_ = method;
+  req.url_ = url;
+  for (auto &p : params)
+    req.params_.emplace_back(String(p.first), String(p.second), false);
+  server.dispatch(&req);
+  return req.response_ ? req.response_->body : std::string();
+}
+
+static uint32_t book(double inS, double holdS)
+{
+  std::string body = call(HTTP_POST, "/reservations", {{"in", std::to_string(inS)}, {"hold", std::to_string(holdS)}});
+  size_t at = body.find("\"id\":");
+  return at == std::string::npos ? 0 : (uint32_t)atol(body.c_str() + at + 5);
+}
+
+struct Run
+{
+  std::vector<unsigned long> openedAt; // fully open, ms since the scenario began
+  std::vector<unsigned long> closingAt;
+  std::string timers;                  // /timers one tick after booking
+};
+
+// Runs the firmware until `untilMs` after t0, logging the deck transitions
+static Run runUntil(unsigned long t0, unsigned long untilMs, std::function<void(unsigned long)> at = nullptr)
+{
+  Run r;
+  MotorState last = currentState;
+  while (millis() - t0 < untilMs)
+  {
+    if (at)
+      at(millis() - t0);
+    loop();
+    if (currentState != last)
+    {
+      if (currentState == BRIDGE_OPEN)
+        r.openedAt.push_back(millis() - t0);
+      if (currentState == BRIDGE_CLOSING)
+        r.closingAt.push_back(millis() - t0);
+      last = currentState;
+    }
+  }
+  return r;
+}
+
+static int failures = 0;
+
+static void expect(const char *scenario, bool ok, const std::string &what)
+{
+  printf("%-8s %s %s\n", scenario, ok ? "ok  " : "FAIL", what.c_str());
+  if (!ok)
+    failures++;
+}
+
+static bool near(unsigned long got, unsigned long want, unsigned long tol)
+{
+  return got + tol >= want && got <= want + tol;
+}
+
+int main(int argc, char **argv)
+{
+  unsigned long tol = 200; // a few control ticks
+  for (int i = 1; i < argc; i++)
+  {
+    std::string a = argv[i];
+    if (a == "--tolerance-ms" && i + 1 < argc)
+      tol = (unsigned long)atol(argv[++i]);
+    else
+    {
+      fprintf(stderr, "unknown option %s\n", a.c_str());
+      return 1;
+    }
+  }
+
+  hostVirtualTime = true;
+  hostSerialQuiet = true;
+  hostWiFiConnectMs = -1;
+  hostEchoModel = [](int) {
+    unsigned long now = millis();
+    return now >= boatFromMs && now < boatToMs ? (unsigned long)(30 * 2 / 0.034f) : 0UL;
+  };
+  setup();
+  setupRoutes();
+  runUntil(millis(), 1000);
+
+  const unsigned long lead = resvLeadMs(), closeMs = BOAT_WARNING_MS + ROTATION_DURATION;
+  const unsigned long settle = 30000; // let the bridge close between scenarios
+  char buf[160];
+
+  // single
+  {
+    unsigned long t0 = millis();
+    book(60, 20);
+    loop();
+    std::string timers = call(HTTP_GET, "/timers");
+    Run r = runUntil(t0, 60000 + 20000 + CLEAR_WINDOW_MS + closeMs + settle);
+    snprintf(buf, sizeof(buf), "/timers next: %s", timers.substr(timers.find("\"next\"")).c_str());
+    size_t at = timers.find("\"open_in_ms\":");
+    long openIn = at == std::string::npos ? 0 : atol(timers.c_str() + at + 13);
+    expect("single", timers.find("\"reservations\":1") != std::string::npos && near(openIn, 60000, tol), buf);
+    snprintf(buf, sizeof(buf), "open at %lu ms, booked 60000", r.openedAt.empty() ? 0 : r.openedAt[0]);
+    expect("single", r.openedAt.size() == 1 && near(r.openedAt[0], 60000, tol), buf);
+    unsigned long wantClose = 80000 + CLEAR_WINDOW_MS;
+    snprintf(buf, sizeof(buf), "closing at %lu ms, want %lu", r.closingAt.empty() ? 0 : r.closingAt[0], wantClose);
+    expect("single", r.closingAt.size() == 1 && near(r.closingAt[0], wantClose, tol), buf);
+  }
+
+  // merged: the gap is shorter than closing plus the lead
+  {
+    unsigned long t0 = millis();
+    double gapS = (closeMs + lead) / 1000.0 - 2;
+    book(40, 10);
+    book(50 + gapS, 10);
+    Run r = runUntil(t0, 60000 + (unsigned long)(gapS * 1000) + CLEAR_WINDOW_MS + closeMs + settle);
+    snprintf(buf, sizeof(buf), "%zu opening(s), %zu closing(s), gap %.1f s", r.openedAt.size(), r.closingAt.size(),
+             gapS);
+    expect("merged", r.openedAt.size() == 1 && r.closingAt.size() == 1 && near(r.openedAt[0], 40000, tol), buf);
+  }
+
+  // apart: the gap leaves time to close and reopen
+  {
+    unsigned long t0 = millis();
+    double gapS = (closeMs + lead + CLEAR_WINDOW_MS) / 1000.0 + 5;
+    book(40, 10);
+    book(50 + gapS, 10);
+    Run r = runUntil(t0, 60000 + (unsigned long)(gapS * 1000) + CLEAR_WINDOW_MS + closeMs + settle);
+    unsigned long second = 50000 + (unsigned long)(gapS * 1000);
+    snprintf(buf, sizeof(buf), "%zu opening(s) at %lu, %lu ms, want 40000, %lu", r.openedAt.size(),
+             r.openedAt.size() > 0 ? r.openedAt[0] : 0, r.openedAt.size() > 1 ? r.openedAt[1] : 0, second);
+    expect("apart", r.openedAt.size() == 2 && near(r.openedAt[0], 40000, tol) && near(r.openedAt[1], second, tol),
+           buf);
+  }
+
+  // cancel
+  {
+    unsigned long t0 = millis();
+    uint32_t id = book(40, 10);
+    Run r = runUntil(t0, 60000, [&](unsigned long t) {
+      if (t >= 10000 && id)
+      {
+        call(HTTP_POST, "/reservations/cancel", {{"id", std::to_string(id)}});
+        id = 0;
+      }
+    });
+    snprintf(buf, sizeof(buf), "%zu opening(s) after cancelling", r.openedAt.size());
+    expect("cancel", r.openedAt.empty(), buf);
+  }
+
+  // boat: arrives 20 s before the booking and leaves at once
+  {
+    unsigned long t0 = millis();
+    book(60, 20);
+    boatFromMs = t0 + 40000;
+    boatToMs = t0 + 45000;
+    Run r = runUntil(t0, 80000 + CLEAR_WINDOW_MS + closeMs + settle);
+    unsigned long wantClose = 80000 + CLEAR_WINDOW_MS;
+    snprintf(buf, sizeof(buf), "%zu opening(s), closing at %lu ms, want %lu", r.openedAt.size(),
+             r.closingAt.empty() ? 0 : r.closingAt[0], wantClose);
+    expect("boat", r.openedAt.size() == 1 && r.openedAt[0] < 60000 && r.closingAt.size() == 1 &&
+                       near(r.closingAt[0], wantClose, tol), buf);
+  }
+
+  // late: booked 2 s ahead, so it opens after the full warning sequence
+  {
+    unsigned long t0 = millis();
+    unsigned long sequence = ROAD_WARNING_MS + BOAT_WARNING_MS + ROTATION_DURATION;
+    std::string body = call(HTTP_POST, "/reservations", {{"in", "2"}, {"hold", "10"}});
+    Run r = runUntil(t0, 12000 + CLEAR_WINDOW_MS + closeMs + settle);
+    snprintf(buf, sizeof(buf), "open at %lu ms, want %lu (warnings + rotation)", r.openedAt.empty() ? 0 : r.openedAt[0],
+             sequence);
+    expect("late", body.find("\"late\":true") != std::string::npos && r.openedAt.size() == 1 &&
+                       near(r.openedAt[0], sequence, lead - sequence + tol), buf);
+  }
+
+  std::string list = call(HTTP_GET, "/reservations");
+  expect("table", list.find("\"list\":[]") != std::string::npos, "empty after all scenarios: " + list);
+
+  printf("%s\n", failures ? "FAIL" : "ok");
+  return failures ? 1 : 0;
+}
@@ -0,0 +1,289 @@
+// Warm-restart check: resets the controller at random points and checks
+// that it carries on from its RTC checkpoint. Every boot is a fork()ed
+// process, so the firmware's globals start fresh as on the board. Only the
+// RTC_NOINIT_ATTR section (host/Arduino.h) is carried from one boot into
+// the next. The deck and the boats live outside the controller: the deck
+// stays where the last boot left it, and boats keep coming while the
+// controller is down.
+//
+//   g++ -std=c++17 -O2 -Ihost tools/reset_check.cpp -o reset_check -pthread
+//   ./reset_check --resets 300 --seed 1
+//
+// Options:
+//   --resets N     resets to run (default 300)
+//   --seed S       random seed (default 1)
+//   --up-ms N      mean time between resets (default 8000)
+//   --torn P       percent of resets landing in the middle of a checkpoint
+//                  write; the newest slot is left corrupt (default 10)
+//   --cold         turn warm restart off (baseline)
+//
+// Virtual time. The first boot finds random RTC contents, as after power-on,
+// and must cold-start. After every later reset it checks:
+// - the controller came back in the state it was reset in, or in the
+//   state of the tick before for a torn write, and a fault stays a fault;
+// - its deck estimate is off by no more than the slack it came back with
+//   (actuator.h); a reset with the drive on lands part-way through a tick;
+// - the first control tick is within FIRST_TICK_BUDGET_MS.
+// On every tick, and straight after setup(), it also checks the lamps
+// against the real deck: road green only with the deck down, boat green
+// only with it fully up. With warm restart on, exits 1 on any failure.
+#include "../src/main.cpp"
+
+#include <sys/mman.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+#include <random>
+#include <string>
+
+extern "C" uint8_t __start_rtc_noinit[], __stop_rtc_noinit[];
+
+const unsigned long BOAT_PERIOD_MS = 90000; // a boat every 90 s ...
+const unsigned long BOAT_STAY_MS = 20000;   // ... in front of sensor A for 20 s
+const unsigned long ESTOP_PERIOD_MS = 600000;
+const unsigned long ESTOP_HOLD_MS = 40000; // then reset over the API
+const int RTC_MAX = 4096;
+
+struct World
+{
+  uint8_t rtc[RTC_MAX];
+  long worldMs;      // outside clock at the last tick
+  uint16_t deckReal; // where the deck really is
+  int8_t deckDir;    // drive direction at the last tick
+  uint8_t state[2];  // controller state at the last two ticks
+  int ticks;         // ticks of the current boot
+  // Per boot, filled by the child
+  bool warm;
+  uint8_t resumed;
+  long deckErr;
+  long deckSlack; // what the controller allows for, per mille
+  unsigned long firstTickMs;
+  uint32_t unsafeTicks;
+  uint32_t openings;
+  bool done;
+};
+
+static World *world;
+static long bootWorldMs = 0;
+
+static long worldNow()
+{
+  return bootWorldMs + (long)millis();
+}
+
+static unsigned long echo(int pin)
+{
+  long t = worldNow() % BOAT_PERIOD_MS;
+  bool boat = pin == echoPin_A && t >= 10000 && t < 10000 + (long)BOAT_STAY_MS;
+  return boat ? (unsigned long)(30 * 2 / 0.034f) : 0;
+}
+
+// Road green needs the deck down, boat green needs it all the way up
+static bool lampsUnsafe(int deckReal)
+{
+  return (roadLamps[2].pattern().lit() && deckReal != DECK_CLOSED) ||
+         (boatLamps[2].pattern().lit() && deckReal != DECK_OPEN);
+}
+
+// One boot, in the child: runs until the outside clock reaches resetAt
+static void boot(long resetAt)
+{
+  size_t rtcLen = __stop_rtc_noinit - __start_rtc_noinit;
+  memcpy(__start_rtc_noinit, world->rtc, rtcLen);
+  bootWorldMs = world->worldMs;
+  hostVirtualTime = true;
+  hostSerialQuiet = true;
+  hostWiFiConnectMs = -1;
+  hostEchoModel = echo;
+
+  setup();
+  world->warm = checkpointSeq != 0;
+  world->resumed = (uint8_t)currentState;
+  // The estimate may be off. The real deck moves as far as the drive
+  // runs, and stops at either end whatever the estimate says.
+  int real = world->deckReal, estimate = deck.position();
+  world->deckErr = labs((long)real - estimate);
+  world->deckSlack = (long)(deck.slackMs() * DECK_OPEN / ROTATION_DURATION) + 1;
+  world->unsafeTicks = lampsUnsafe(real);
+
+  uint8_t last = (uint8_t)currentState;
+  while (worldNow() < resetAt)
+  {
+    long t = worldNow();
+    if (t % ESTOP_PERIOD_MS >= ESTOP_PERIOD_MS - ESTOP_HOLD_MS - 1000 &&
+        t % ESTOP_PERIOD_MS < ESTOP_PERIOD_MS - ESTOP_HOLD_MS && currentState != FAULT)
+      estopTrip(ESTOP_API, isrCycles());
+    else if (t % ESTOP_PERIOD_MS < 1000 && currentState == FAULT)
+    {
+      uint32_t seq;
+      enqueueCommand(CMD_FAULT_RESET, seq);
+    }
+    unsigned long slack = deck.slackMs();
+    int seatDir = deck.target() == DECK_OPEN ? 1 : -1;
+    loop();
+    if (world->ticks++ == 0)
+      world->firstTickMs = firstTickMs;
+    // Slack used up: the drive ran on past the estimate, against an end
+    real += seatDir * (int)((slack - deck.slackMs()) * DECK_OPEN / ROTATION_DURATION);
+    real = constrain(real + deck.position() - estimate, 0, (int)DECK_OPEN);
+    estimate = deck.position();
+    world->unsafeTicks += lampsUnsafe(real);
+    if (currentState == BRIDGE_OPEN && last != BRIDGE_OPEN)
+      world->openings++;
+    last = (uint8_t)currentState;
+    // What survives a reset now
+    memcpy(world->rtc, __start_rtc_noinit, rtcLen);
+    world->state[1] = world->state[0];
+    world->state[0] = (uint8_t)currentState;
+    world->deckReal = (uint16_t)real;
+    world->deckDir = (int8_t)deck.direction();
+    world->worldMs = worldNow();
+  }
+  world->done = true;
+}
+
+int main(int argc, char **argv)
+{
+  int resets = 300, tornPct = 10;
+  unsigned seed = 1;
+  long upMs = 8000;
+  for (int i = 1; i < argc; i++)
+  {
+    std::string a = argv[i];
+    const char *v = i + 1 < argc ? argv[i + 1] : "";
+    if (a == "--resets")
+      resets = atoi(v), i++;
+    else if (a == "--seed")
+      seed = (unsigned)atol(v), i++;
+    else if (a == "--up-ms")
+      upMs = atol(v), i++;
+    else if (a == "--torn")
+      tornPct = atoi(v), i++;
+    else if (a == "--cold")
+      WARM_RESTART = false;
+    else
+    {
+      fprintf(stderr, "unknown option %s\n", a.c_str());
+      return 1;
+    }
+  }
+  size_t rtcLen = __stop_rtc_noinit - __start_rtc_noinit;
+  if (resets < 1 || upMs < 100 || rtcLen > (size_t)RTC_MAX)
+  {
+    fprintf(stderr, "bad arguments\n");
+    return 1;
+  }
+
+  world = (World *)mmap(nullptr, sizeof(World), PROT_READ | PROT_WRITE, MAP_SHARED | MAP_ANONYMOUS, -1, 0);
+  if (world == MAP_FAILED)
+  {
+    perror("mmap");
+    return 1;
+  }
+  memset(world, 0, sizeof(World));
+  std::mt19937 rng(seed);
+  for (size_t i = 0; i < rtcLen; i++)
+    world->rtc[i] = (uint8_t)rng(); // power-on: whatever the RTC RAM holds
+  size_t slotsAt = (uint8_t *)checkpoints - __start_rtc_noinit;
+
+  // Per state at the reset: resets, resumed right, worst deck error
+  int byState[FAULT + 1] = {}, resumedOk[FAULT + 1] = {};
+  long deckErrMax[FAULT + 1] = {};
+  int failures = 0, torn = 0, coldBoots = 0, unsafeBoots = 0;
+  uint32_t unsafeTicks = 0, openings = 0;
+  unsigned long firstTickMax = 0;
+  // Travel in one tick: the 50 ms delay and two 30 ms echo timeouts
+  const int deckTick = (int)(110 * DECK_OPEN / ROTATION_DURATION);
+
+  bool tornNow = false;
+  for (int b = 0; b <= resets; b++)
+  {
+    uint8_t before = world->state[0], beforeTorn = world->state[1];
+    long resetAt = world->worldMs + 1000 + (long)(rng() % (unsigned long)(2 * upMs - 1000));
+    world->ticks = 0;
+    world->openings = 0;
+    world->done = false;
+    fflush(stdout);
+    pid_t pid = fork();
+    if (pid < 0)
+    {
+      perror("fork");
+      return 1;
+    }
+    if (pid == 0)
+    {
+      boot(resetAt);
+      _exit(0);
+    }
+    int status;
+    waitpid(pid, &status, 0);
+    if (!world->done)
+    {
+      printf("boot %d died\n", b);
+      return 1;
+    }
+
+    unsafeTicks += world->unsafeTicks;
+    unsafeBoots += world->unsafeTicks > 0;
+    openings += world->openings;
+    if (world->firstTickMs > firstTickMax)
+      firstTickMax = world->firstTickMs;
+    bool ok;
+    if (b == 0)
+    {
+      // Power-on: random RTC contents must not pass for a checkpoint
+      ok = !world->warm && world->resumed == IDLE;
+      coldBoots += !world->warm;
+      if (!ok)
+        printf("boot 0: power-on garbage taken as a checkpoint\n");
+    }
+    else
+    {
+      uint8_t want = tornNow ? beforeTorn : before;
+      bool stateOk = world->resumed == want;
+      ok = world->warm && stateOk && world->deckErr <= world->deckSlack && world->firstTickMs <= FIRST_TICK_BUDGET_MS;
+      coldBoots += !world->warm;
+      byState[before]++;
+      resumedOk[before] += stateOk;
+      if (world->deckErr > deckErrMax[before])
+        deckErrMax[before] = world->deckErr;
+    }
+    if (world->unsafeTicks)
+      ok = false;
+    if (!ok && b > 0)
+      printf("boot %d: reset in %s%s, came back %s in %s, deck off by %ld (slack %ld), first tick %lu ms, %u unsafe "
+             "ticks\n",
+             b, stateString((MotorState)before), tornNow ? " (torn)" : "", world->warm ? "warm" : "cold",
+             stateString((MotorState)world->resumed), world->deckErr, world->deckSlack, world->firstTickMs,
+             world->unsafeTicks);
+    failures += !ok;
+
+    // Some resets land while a checkpoint is half written
+    tornNow = b > 0 && (int)(rng() % 100) < tornPct;
+    if (tornNow)
+    {
+      Checkpoint *slots = (Checkpoint *)(world->rtc + slotsAt);
+      Checkpoint &newest = (int32_t)(slots[0].seq - slots[1].seq) > 0 ? slots[0] : slots[1];
+      ((uint8_t *)&newest)[rng() % offsetof(Checkpoint, sum)] ^= (uint8_t)(1 + rng() % 255);
+      torn++;
+    }
+    else
+    {
+      // Otherwise it lands part-way through the next tick, drive still on
+      int ran = world->deckDir * (int)(rng() % (deckTick + 1));
+      world->deckReal = (uint16_t)constrain(world->deckReal + ran, 0, (int)DECK_OPEN);
+    }
+    world->worldMs += 200 + (long)(rng() % 600); // down while it boots
+  }
+
+  printf("%d resets (%d torn), up %.1f s on average, warm restart %s\n", resets, torn, upMs / 1000.0,
+         WARM_RESTART ? "on" : "off");
+  printf("%-14s %7s %8s %13s\n", "reset in", "resets", "resumed", "deck_err_max");
+  for (int s = 0; s <= FAULT; s++)
+    printf("%-14s %7d %8d %13ld\n", stateString((MotorState)s), byState[s], resumedOk[s], deckErrMax[s]);
+  printf("cold boots %d (1 expected, power-on)\n", coldBoots);
+  printf("first tick after boot: max %lu ms (budget %lu ms)\n", firstTickMax, FIRST_TICK_BUDGET_MS);
+  printf("unsafe lamp ticks %u in %d boots, openings %u\n", unsafeTicks, unsafeBoots, openings);
+  printf("%s\n", failures ? "FAIL" : "ok");
+  return WARM_RESTART && failures ? 1 : 0;
+}
@@ -0,0 +1,82 @@
+// In-process benchmark of the status routes: runs requests through the
+// firmware's route table (no sockets) and reports CPU cost per request, plus
+// the per-tick cost of publishing the status snapshot, for a growing number
+// of dashboards.
+//
+//   g++ -std=c++17 -O2 -Ihost tools/status_bench.cpp -o status_bench -pthread
+//   ./status_bench [ticks]
+//
+// Each simulated tick publishes one snapshot and then serves one request per
+// status route per dashboard, which is the load the long-poll UI makes while
+// the state is changing.
+#include "../src/main.cpp"
+
+#include <chrono>
+
+using BenchClock = std::chrono::steady_clock;
+
+static double nsSince(BenchClock::time_point t0)
+{
+  return (double)std::chrono::duration_cast<std::chrono::nanoseconds>(BenchClock::now() - t0).count();
+}
+
+static AsyncWebServerRequest makeRequest(const char *url)
+{
+  AsyncWebServerRequest req;
+  req.method_ = HTTP_GET;
+  req.url_ = url;
+  return req;
+}
+
+int main(int argc, char **argv)
+{
+  int ticks = argc > 1 ? atoi(argv[1]) : 2000;
+  const char *urls[] = {"/state", "/lights", "/timers", "/distance", "/mode"};
+  const int routeCount = sizeof(urls) / sizeof(urls[0]);
+
+  hostSerialQuiet = true;
+  hostWiFiConnectMs = -1; // no server thread: this thread is the only reader
+  setup();
+  setupRoutes();
+
+  // Per route, one dashboard
+  printf("%-10s %10s\n", "route", "ns/req");
+  for (int r = 0; r < routeCount; r++)
+  {
+    AsyncWebServerRequest req = makeRequest(urls[r]);
+    BenchClock::time_point t0 = BenchClock::now();
+    for (int i = 0; i < ticks * 10; i++)
+      server.dispatch(&req);
+    printf("%-10s %10.0f\n", urls[r], nsSince(t0) / (ticks * 10));
+  }
+
+  // Tick-side cost
+  BenchClock::time_point t0 = BenchClock::now();
+  for (int i = 0; i < ticks * 10; i++)
+    publishStatus(millis());
+  double publishNs = nsSince(t0) / (ticks * 10);
+  printf("\npublishStatus: %.0f ns/tick\n\n", publishNs);
+
+  printf("%-10s %14s %14s\n", "dashboards", "ns/req", "ns/req+publish");
+  for (int dashboards : {1, 5, 20, 100})
+  {
+    std::vector<AsyncWebServerRequest> reqs;
+    for (int d = 0; d < dashboards; d++)
+      for (int r = 0; r < routeCount; r++)
+        reqs.push_back(makeRequest(urls[r]));
+    double serveNs = 0;
+    t0 = BenchClock::now();
+    for (int i = 0; i < ticks; i++)
+    {
+      publishStatus(millis());
+      BenchClock::time_point s0 = BenchClock::now();
+      for (auto &req : reqs)
+        server.dispatch(&req);
+      serveNs += nsSince(s0);
+    }
+    double total = nsSince(t0);
+    double n = (double)ticks * reqs.size();
+    printf("%-10d %14.0f %14.0f\n", dashboards, serveNs / n, total / n);
+  }
+  return 0;
+}
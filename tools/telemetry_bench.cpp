@@ -0,0 +1,201 @@
+// Collector capacity bench for the telemetry uplink (src/telemetry.h).
+// Runs tools/telemetry_collector.h on a loopback UDP socket in one thread and
+// floods it from sender threads, each playing many devices. Every batch is a
+// realistic 30 s one: a distance and a road summary per second, metrics every
+// 10 s and the odd state change, encoded by the firmware's own
+// TelemetryWriter. Senders keep a window of unacked batches in flight, so the
+// rate measured is what the collector acks, not what the kernel dropped.
+//
+//   g++ -std=c++17 -O2 -Ihost tools/telemetry_bench.cpp -o telemetry_bench -pthread
+//   ./telemetry_bench --senders 2 --devices 1000 --seconds 5
+//
+// Options:
+//   --senders N   sender threads (default 2)
+//   --devices N   devices per sender (default 1000)
+//   --window N    unacked batches per sender (default 32)
+//   --seconds S   run time (default 5)
+//   --csv         format every record as the collector would for a file
+//                 (written to /dev/null); off, records are decoded only
+//
+// Prints batches and records acked per second, the collector thread's CPU
+// use, and how many devices one collector thread keeps up with at one batch
+// per device every TEL_BATCH_MS.
+#include "telemetry_collector.h"
+
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <time.h>
+#include <unistd.h>
+
+#include <string>
+#include <thread>
+#include <vector>
+
+static std::atomic<bool> sending(true);
+static std::atomic<uint64_t> ackedTotal(0), timeoutsTotal(0);
+
+// 30 s of one device's records, as serviceTelemetry() would make them
+static void fillBatch(TelemetryWriter &w, TelemetryBatch &b, uint32_t device, unsigned long t0, std::minstd_rand &rng)
+{
+  w.open(b, t0);
+  int32_t vehicles = (int32_t)(device * 7 % 1000), ticks = (int32_t)(t0 / 50);
+  for (int s = 0; s < 30 && w.fits(b); s++)
+  {
+    unsigned long at = t0 + s * 1000 + rng() % 20;
+    int32_t a = 3800 + (int32_t)(rng() % 40), bb = 3900 + (int32_t)(rng() % 40);
+    int32_t dist[7] = {20, a - 15, a, a + 12, bb - 18, bb, bb + 9};
+    w.add(b, TEL_DISTANCE, dist, at);
+    bool car = rng() % 4 == 0;
+    vehicles += car;
+    int32_t road[3] = {vehicles, car ? (int32_t)(rng() % 400) : 0, car};
+    w.add(b, TEL_ROAD, road, at);
+    if (s % 10 == 9)
+    {
+      ticks += 200;
+      int32_t metrics[5] = {ticks, 3 + (int32_t)(rng() % 4), 180000 - (int32_t)(rng() % 64) * 16, 0, (int32_t)s / 10};
+      w.add(b, TEL_METRICS, metrics, at);
+    }
+    if (rng() % 60 == 0)
+    {
+      int32_t state = (int32_t)(rng() % 6);
+      w.add(b, TEL_STATE, &state, at);
+    }
+  }
+}
+
+static void sender(int index, int devices, int window, uint16_t port)
+{
+  int fd = socket(AF_INET, SOCK_DGRAM, 0);
+  sockaddr_in to{};
+  to.sin_family = AF_INET;
+  to.sin_port = htons(port);
+  to.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+  timeval tv{0, 50000};
+  setsockopt(fd, SOL_SOCKET, SO_RCVTIMEO, &tv, sizeof(tv));
+
+  std::vector<TelemetryWriter> writers;
+  for (int d = 0; d < devices; d++)
+    writers.emplace_back((uint32_t)(index << 20 | d));
+  std::minstd_rand rng((unsigned)index + 1);
+  TelemetryBatch b;
+  uint8_t ack[64];
+  unsigned long t = 0;
+  int next = 0, inflight = 0;
+  while (sending.load(std::memory_order_relaxed))
+  {
+    while (inflight < window)
+    {
+      if (next == 0)
+        t += TEL_BATCH_MS;
+      fillBatch(writers[next], b, writers[next].device(), t, rng);
+      next = (next + 1) % devices;
+      if (sendto(fd, b.buf, b.len, 0, (sockaddr *)&to, sizeof(to)) == b.len)
+        inflight++;
+    }
+    ssize_t n = recv(fd, ack, sizeof(ack), 0);
+    if (n == (ssize_t)TEL_ACK_BYTES && ack[0] == 'B' && ack[1] == 'A')
+    {
+      inflight--;
+      ackedTotal++;
+    }
+    else if (n < 0)
+    {
+      inflight = 0; // window lost in the socket buffers: start over
+      timeoutsTotal++;
+    }
+  }
+  close(fd);
+}
+
+static double threadCpuS()
+{
+  timespec ts;
+  clock_gettime(CLOCK_THREAD_CPUTIME_ID, &ts);
+  return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+int main(int argc, char **argv)
+{
+  int senders = 2, devices = 1000, window = 32;
+  double seconds = 5;
+  bool csv = false;
+  for (int i = 1; i < argc; i++)
+  {
+    std::string a = argv[i];
+    const char *v = i + 1 < argc ? argv[i + 1] : "";
+    if (a == "--senders")
+      senders = atoi(v), i++;
+    else if (a == "--devices")
+      devices = atoi(v), i++;
+    else if (a == "--window")
+      window = atoi(v), i++;
+    else if (a == "--seconds")
+      seconds = atof(v), i++;
+    else if (a == "--csv")
+      csv = true;
+    else
+    {
+      fprintf(stderr, "unknown option %s\n", a.c_str());
+      return 1;
+    }
+  }
+  if (senders < 1 || devices < 1 || window < 1 || seconds <= 0)
+  {
+    fprintf(stderr, "bad arguments\n");
+    return 1;
+  }
+
+  int fd = socket(AF_INET, SOCK_DGRAM, 0);
+  sockaddr_in addr{};
+  addr.sin_family = AF_INET;
+  addr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+  int rcvbuf = 4 << 20;
+  setsockopt(fd, SOL_SOCKET, SO_RCVBUF, &rcvbuf, sizeof(rcvbuf));
+  socklen_t len = sizeof(addr);
+  if (bind(fd, (sockaddr *)&addr, sizeof(addr)) != 0 || getsockname(fd, (sockaddr *)&addr, &len) != 0)
+  {
+    perror("bind");
+    return 1;
+  }
+  uint16_t port = ntohs(addr.sin_port);
+
+  FILE *sink = csv ? fopen("/dev/null", "w") : nullptr;
+  TelemetryCollector collector(sink);
+  std::atomic<bool> running(true);
+  double collectorCpuS = 0;
+  std::thread collect([&] {
+    double cpu0 = threadCpuS();
+    serveTelemetry(fd, collector, running);
+    collectorCpuS = threadCpuS() - cpu0;
+  });
+
+  unsigned long t0 = millis();
+  std::vector<std::thread> threads;
+  for (int i = 0; i < senders; i++)
+    threads.emplace_back(sender, i, devices, window, port);
+  std::this_thread::sleep_for(std::chrono::duration<double>(seconds));
+  sending = false;
+  for (std::thread &t : threads)
+    t.join();
+  double wallS = (millis() - t0) / 1000.0;
+  running = false;
+  collect.join();
+
+  const CollectorStats &s = collector.stats();
+  double batchesPerS = ackedTotal / wallS;
+  double cpuPerBatchUs = s.batches ? collectorCpuS * 1e6 / s.batches : 0;
+  printf("devices %d x %d, window %d, %s, %.1f s\n", senders, devices, window, csv ? "csv" : "decode only", wallS);
+  printf("batches acked     %llu (%.0f/s)\n", (unsigned long long)ackedTotal.load(), batchesPerS);
+  printf("records           %llu (%.0f/s), %.1f per batch\n", (unsigned long long)s.records, s.records / wallS,
+         s.batches ? (double)s.records / s.batches : 0.0);
+  printf("bytes             %.1f MB (%.0f per batch)\n", s.bytes / 1e6, s.batches ? (double)s.bytes / s.batches : 0.0);
+  printf("duplicates / bad  %llu / %llu, window timeouts %llu\n", (unsigned long long)s.duplicates,
+         (unsigned long long)s.bad, (unsigned long long)timeoutsTotal.load());
+  printf("collector cpu     %.0f%% of one core, %.1f us per batch\n", collectorCpuS * 100 / wallS, cpuPerBatchUs);
+  printf("devices at one batch per %lu s: %.0f at this rate, %.0f per collector core\n", TEL_BATCH_MS / 1000,
+         batchesPerS * TEL_BATCH_MS / 1000, cpuPerBatchUs > 0 ? TEL_BATCH_MS * 1000 / cpuPerBatchUs : 0.0);
+  if (sink)
+    fclose(sink);
+  close(fd);
+  return s.batches ? 0 : 1;
+}
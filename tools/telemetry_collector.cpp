@@ -0,0 +1,81 @@
+// Telemetry collector for any number of bridge controllers (src/telemetry.h).
+//
+//   g++ -std=c++17 -O2 -Ihost tools/telemetry_collector.cpp -o telemetry_collector -pthread
+//   ./telemetry_collector --port 7000 --out telemetry.csv
+//   curl -XPOST 'http://<board>/telemetry?host=<this machine>&port=7000'
+//
+// Options:
+//   --port N     UDP port to listen on (default 7000)
+//   --out FILE   CSV of every record, appended; "-" for stdout (default
+//                telemetry.csv)
+//   --stats-s S  print totals every S seconds to stderr (default 10, 0 = off)
+//
+// CSV columns: device,batch,device_ms,type,fields... with the fields of each
+// type listed next to TelemetryType in src/telemetry.h.
+#include "telemetry_collector.h"
+
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <unistd.h>
+
+#include <string>
+
+int main(int argc, char **argv)
+{
+  int port = 7000, statsS = 10;
+  std::string outPath = "telemetry.csv";
+  for (int i = 1; i < argc; i++)
+  {
+    std::string a = argv[i];
+    const char *v = i + 1 < argc ? argv[i + 1] : "";
+    if (a == "--port")
+      port = atoi(v), i++;
+    else if (a == "--out")
+      outPath = v, i++;
+    else if (a == "--stats-s")
+      statsS = atoi(v), i++;
+    else
+    {
+      fprintf(stderr, "unknown option %s\n", a.c_str());
+      return 1;
+    }
+  }
+
+  FILE *out = outPath == "-" ? stdout : fopen(outPath.c_str(), "a");
+  if (!out)
+  {
+    perror(outPath.c_str());
+    return 1;
+  }
+  int fd = socket(AF_INET, SOCK_DGRAM, 0);
+  sockaddr_in addr{};
+  addr.sin_family = AF_INET;
+  addr.sin_port = htons((uint16_t)port);
+  addr.sin_addr.s_addr = htonl(INADDR_ANY);
+  int rcvbuf = 4 << 20;
+  setsockopt(fd, SOL_SOCKET, SO_RCVBUF, &rcvbuf, sizeof(rcvbuf));
+  if (bind(fd, (sockaddr *)&addr, sizeof(addr)) != 0)
+  {
+    perror("bind");
+    return 1;
+  }
+
+  TelemetryCollector collector(out);
+  std::atomic<bool> running(true);
+  std::thread stats;
+  if (statsS > 0)
+    stats = std::thread([&] {
+      while (running)
+      {
+        std::this_thread::sleep_for(std::chrono::seconds(statsS));
+        const CollectorStats &s = collector.stats();
+        fprintf(stderr, "devices %zu  batches %llu  records %llu  duplicates %llu  bad %llu  bytes %llu\n",
+                collector.devices(), (unsigned long long)s.batches, (unsigned long long)s.records,
+                (unsigned long long)s.duplicates, (unsigned long long)s.bad, (unsigned long long)s.bytes);
+        fflush(out);
+      }
+    });
+  fprintf(stderr, "collecting on udp/%d into %s\n", port, outPath.c_str());
+  serveTelemetry(fd, collector, running);
+  return 0;
+}
@@ -0,0 +1,200 @@
+// Reference telemetry collector: decodes the batches of src/telemetry.h,
+// acks them, drops duplicates (a resend whose ack was lost) and appends
+// every record of a batch that decodes whole to one CSV stream:
+//   device,batch,device_ms,type,fields...
+// Used by tools/telemetry_collector.cpp and tools/telemetry_bench.cpp.
+#pragma once
+
+#include "../src/telemetry.h"
+
+#include <sys/socket.h>
+
+#include <string>
+#include <unordered_map>
+
+const char *const TEL_TYPE_NAMES[TEL_TYPES] = {"state", "distance", "road", "metrics"};
+
+struct CollectorStats
+{
+  uint64_t batches = 0;
+  uint64_t duplicates = 0;
+  uint64_t bad = 0;
+  uint64_t records = 0;
+  uint64_t bytes = 0;
+};
+
+class TelemetryCollector
+{
+public:
+  // out may be null: decode and ack without storing
+  explicit TelemetryCollector(FILE *out) : out_(out) {}
+
+  // One datagram in; true with ack filled in if it should be acked
+  bool handle(const uint8_t *p, size_t len, uint8_t (&ack)[TEL_ACK_BYTES])
+  {
+    stats_.bytes += len;
+    if (len < TEL_HEADER_BYTES || p[0] != 'B' || p[1] != 'T' || p[2] != TEL_VERSION)
+    {
+      stats_.bad++;
+      return false;
+    }
+    uint32_t device = TelemetryWriter::get32(p + 4);
+    uint32_t seq = TelemetryWriter::get32(p + 8);
+    uint32_t baseMs = TelemetryWriter::get32(p + 12);
+    uint16_t records = (uint16_t)(p[16] | p[17] << 8);
+    uint32_t boot = TelemetryWriter::get32(p + 20);
+    ack[0] = 'B';
+    ack[1] = 'A';
+    ack[2] = TEL_VERSION;
+    ack[3] = 0;
+    TelemetryWriter::put32(ack + 4, device);
+    TelemetryWriter::put32(ack + 8, seq);
+
+    DeviceWindow &w = window(device, boot);
+    if (seenBefore(w, seq))
+    {
+      stats_.duplicates++;
+      return true; // ack again: the first ack was lost
+    }
+    // Only a batch that decodes whole is marked seen and written out, so a
+    // corrupt copy neither blocks the good resend nor leaves half its rows
+    if (!decode(p, len, device, seq, baseMs, records))
+    {
+      stats_.bad++;
+      return false;
+    }
+    markSeen(w, seq);
+    if (out_)
+      fwrite(rows_.data(), 1, rows_.size(), out_);
+    stats_.records += records;
+    stats_.batches++;
+    return true;
+  }
+
+  const CollectorStats &stats() const { return stats_; }
+  size_t devices() const { return devices_.size(); }
+
+private:
+  // Per device and boot: the highest batch seq seen and a bitmap of the 64
+  // below it
+  struct DeviceWindow
+  {
+    uint32_t boot = 0;
+    uint32_t highest = 0;
+    uint64_t seen = 0;
+  };
+
+  // A device's current boot, and the one before for resends that arrive
+  // after the restart
+  struct DeviceBoots
+  {
+    DeviceWindow current, previous;
+  };
+
+  DeviceWindow &window(uint32_t device, uint32_t boot)
+  {
+    DeviceBoots &d = devices_[device];
+    if (d.current.boot == boot)
+      return d.current;
+    if (d.previous.boot == boot)
+      return d.previous;
+    // The device restarted: its seqs start over
+    d.previous = d.current;
+    d.current = DeviceWindow{boot};
+    return d.current;
+  }
+
+  static bool seenBefore(const DeviceWindow &w, uint32_t seq)
+  {
+    int32_t ahead = (int32_t)(seq - w.highest);
+    if (w.highest == 0 || ahead > 0)
+      return false;
+    if (-ahead >= 64)
+      return true; // too old to tell; the device gave up on it long ago
+    return w.seen & 1ull << -ahead;
+  }
+
+  static void markSeen(DeviceWindow &w, uint32_t seq)
+  {
+    int32_t ahead = (int32_t)(seq - w.highest);
+    if (w.highest == 0 || ahead > 0)
+    {
+      w.seen = ahead >= 64 || w.highest == 0 ? 0 : w.seen << ahead;
+      w.seen |= 1;
+      w.highest = seq;
+    }
+    else
+      w.seen |= 1ull << -ahead;
+  }
+
+  static bool getVarint(const uint8_t *p, size_t len, size_t &pos, uint32_t &v)
+  {
+    v = 0;
+    for (int shift = 0; shift < 35 && pos < len; shift += 7)
+    {
+      uint8_t c = p[pos++];
+      v |= (uint32_t)(c & 0x7f) << shift;
+      if (!(c & 0x80))
+        return true;
+    }
+    return false;
+  }
+
+  // Fills rows_ with the batch's CSV lines; false if it does not decode
+  bool decode(const uint8_t *p, size_t len, uint32_t device, uint32_t seq, uint32_t baseMs, uint16_t records)
+  {
+    rows_.clear();
+    int32_t prev[TEL_TYPES][TEL_MAX_FIELDS] = {};
+    uint32_t t = baseMs;
+    size_t pos = TEL_HEADER_BYTES;
+    char line[256];
+    for (uint16_t r = 0; r < records; r++)
+    {
+      uint32_t head;
+      if (!getVarint(p, len, pos, head) || (head & 7) >= TEL_TYPES)
+        return false;
+      uint8_t type = head & 7;
+      t += head >> 3;
+      int n = out_ ? snprintf(line, sizeof(line), "%08x,%u,%u,%s", device, seq, t, TEL_TYPE_NAMES[type]) : 0;
+      for (int f = 0; f < TEL_FIELDS[type]; f++)
+      {
+        uint32_t z;
+        if (!getVarint(p, len, pos, z))
+          return false;
+        prev[type][f] += (int32_t)((z >> 1) ^ (0u - (z & 1)));
+        if (out_)
+          n += snprintf(line + n, sizeof(line) - n, ",%d", prev[type][f]);
+      }
+      if (out_)
+      {
+        rows_.append(line, n);
+        rows_ += '\n';
+      }
+    }
+    return pos == len;
+  }
+
+  FILE *out_;
+  std::string rows_;
+  CollectorStats stats_;
+  std::unordered_map<uint32_t, DeviceBoots> devices_;
+};
+
+// Receives on fd until running goes false, acking each batch it takes
+inline void serveTelemetry(int fd, TelemetryCollector &c, const std::atomic<bool> &running)
+{
+  uint8_t buf[2048];
+  uint8_t ack[TEL_ACK_BYTES];
+  timeval tv{0, 100000};
+  setsockopt(fd, SOL_SOCKET, SO_RCVTIMEO, &tv, sizeof(tv));
+  while (running.load(std::memory_order_relaxed))
+  {
+    sockaddr_in from{};
+    socklen_t fromLen = sizeof(from);
+    ssize_t n = recvfrom(fd, buf, sizeof(buf), 0, (sockaddr *)&from, &fromLen);
+    if (n <= 0)
+      continue;
+    if (c.handle(buf, (size_t)n, ack))
+      sendto(fd, ack, sizeof(ack), 0, (sockaddr *)&from, fromLen);
+  }
+}
@@ -0,0 +1,183 @@
+// Converts a binary event trace (GET /trace) into Chrome trace JSON, which
+// chrome://tracing and ui.perfetto.dev open directly.
+//
+//   g++ -std=c++17 -O2 tools/trace2chrome.cpp -o trace2chrome
+//   curl -s http://<board>/trace -o trace.btr
+//   ./trace2chrome trace.btr > trace.json
+//
+// Dump layout is documented next to buildTraceDump() in src/main.cpp.
+// Timestamps are the low 32 bits of esp_timer, one clock for both cores.
+// They are taken relative to the newest event in the dump, so the dump may
+// span up to ~35 minutes.
+#include <cstdint>
+#include <cstdio>
+#include <map>
+#include <string>
+#include <vector>
+
+enum TraceType : uint8_t
+{
+  TR_TICK_BEGIN = 1,
+  TR_TICK_END,
+  TR_SENSOR_TRIGGER,
+  TR_SENSOR_ECHO,
+  TR_STATE,
+  TR_GPIO,
+  TR_MOTOR,
+  TR_HTTP_BEGIN,
+  TR_HTTP_END
+};
+
+struct Event
+{
+  double us;
+  int core;
+  uint8_t type, a;
+  uint16_t b;
+};
+
+static const int STATE_TRACK = 10;
+
+static uint32_t u32(const std::vector<uint8_t> &d, size_t at)
+{
+  return d[at] | d[at + 1] << 8 | d[at + 2] << 16 | (uint32_t)d[at + 3] << 24;
+}
+
+static std::string readName(const std::vector<uint8_t> &d, size_t &pos)
+{
+  std::string s;
+  while (pos < d.size() && d[pos])
+    s += (char)d[pos++];
+  pos++;
+  return s;
+}
+
+int main(int argc, char **argv)
+{
+  FILE *in = argc > 1 ? fopen(argv[1], "rb") : stdin;
+  if (!in)
+  {
+    perror(argv[1]);
+    return 1;
+  }
+  std::vector<uint8_t> d;
+  uint8_t chunk[4096];
+  size_t n;
+  while ((n = fread(chunk, 1, sizeof(chunk), in)) > 0)
+    d.insert(d.end(), chunk, chunk + n);
+  if (d.size() < 16 || d[0] != 'B' || d[1] != 'T' || d[2] != 'R' || d[3] != '2')
+  {
+    fprintf(stderr, "not a BTR2 trace dump\n");
+    return 1;
+  }
+
+  double perUs = u32(d, 4);
+  int cores = d[8], routeCount = d[9], stateCount = d[10];
+  // The newest stamp of all cores, to take the others relative to
+  uint32_t newest = 0;
+  bool any = false;
+  size_t pos = 16;
+  for (int c = 0; c < cores; c++)
+  {
+    uint32_t count = u32(d, pos);
+    if (count)
+    {
+      uint32_t t = u32(d, pos + 4 + (count - 1) * 8);
+      if (!any || (int32_t)(t - newest) > 0)
+        newest = t;
+      any = true;
+    }
+    pos += 4 + count * 8;
+  }
+  pos = 16;
+  std::vector<Event> events;
+  for (int c = 0; c < cores; c++)
+  {
+    uint32_t count = u32(d, pos);
+    pos += 4;
+    for (uint32_t i = 0; i < count; i++, pos += 8)
+    {
+      double us = (double)(int32_t)(u32(d, pos) - newest) / perUs;
+      events.push_back({us, c, d[pos + 4], d[pos + 5], (uint16_t)(d[pos + 6] | d[pos + 7] << 8)});
+    }
+  }
+  std::vector<std::string> routes, states;
+  for (int i = 0; i < routeCount; i++)
+    routes.push_back(readName(d, pos));
+  for (int i = 0; i < stateCount; i++)
+    states.push_back(readName(d, pos));
+
+  double t0 = events.empty() ? 0 : events[0].us;
+  for (auto &e : events)
+    t0 = e.us < t0 ? e.us : t0;
+
+  printf("{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n");
+  printf("{\"ph\":\"M\",\"pid\":1,\"name\":\"process_name\",\"args\":{\"name\":\"bridge controller\"}}");
+  for (int c = 0; c < cores; c++)
+    printf(",\n{\"ph\":\"M\",\"pid\":1,\"tid\":%d,\"name\":\"thread_name\",\"args\":{\"name\":\"core %d\"}}", c, c);
+  printf(",\n{\"ph\":\"M\",\"pid\":1,\"tid\":%d,\"name\":\"thread_name\",\"args\":{\"name\":\"bridge state\"}}",
+         STATE_TRACK);
+
+  std::map<int, int> depth; // open B events per core, to drop ends cut by the ring
+  const Event *lastState = nullptr;
+  double tEnd = 0;
+  for (auto &e : events)
+  {
+    double ts = e.us - t0;
+    tEnd = ts > tEnd ? ts : tEnd;
+    auto route = [&](uint8_t id) { return id < routes.size() ? routes[id] : std::string("route ") + std::to_string(id); };
+    switch (e.type)
+    {
+    case TR_TICK_BEGIN:
+    case TR_SENSOR_TRIGGER:
+    case TR_HTTP_BEGIN:
+    {
+      std::string name = e.type == TR_TICK_BEGIN       ? "tick"
+                         : e.type == TR_SENSOR_TRIGGER ? "ping echo pin " + std::to_string(e.a)
+                                                       : route(e.a);
+      printf(",\n{\"ph\":\"B\",\"pid\":1,\"tid\":%d,\"ts\":%.3f,\"name\":\"%s\"}", e.core, ts, name.c_str());
+      depth[e.core]++;
+      break;
+    }
+    case TR_TICK_END:
+    case TR_SENSOR_ECHO:
+    case TR_HTTP_END:
+      if (depth[e.core] == 0)
+        break;
+      depth[e.core]--;
+      if (e.type == TR_SENSOR_ECHO)
+        printf(",\n{\"ph\":\"E\",\"pid\":1,\"tid\":%d,\"ts\":%.3f,\"args\":{\"echo_us\":%u}}", e.core, ts, e.b);
+      else
+        printf(",\n{\"ph\":\"E\",\"pid\":1,\"tid\":%d,\"ts\":%.3f}", e.core, ts);
+      break;
+    case TR_STATE:
+      if (lastState)
+      {
+        double s = lastState->us - t0;
+        printf(",\n{\"ph\":\"X\",\"pid\":1,\"tid\":%d,\"ts\":%.3f,\"dur\":%.3f,\"name\":\"%s\"}", STATE_TRACK, s,
+               ts - s, lastState->a < states.size() ? states[lastState->a].c_str() : "?");
+      }
+      lastState = &e;
+      break;
+    case TR_GPIO:
+      printf(",\n{\"ph\":\"i\",\"s\":\"t\",\"pid\":1,\"tid\":%d,\"ts\":%.3f,\"name\":\"%s lamps\","
+             "\"args\":{\"red\":%d,\"yellow\":%d,\"green\":%d,\"flashing\":\"%s%s%s\"}}",
+             e.core, ts, e.a ? "boat" : "road", (e.b >> 2) & 1, (e.b >> 1) & 1, e.b & 1, (e.b & 32) ? "R" : "",
+             (e.b & 16) ? "Y" : "", (e.b & 8) ? "G" : "");
+      break;
+    case TR_MOTOR:
+      printf(",\n{\"ph\":\"C\",\"pid\":1,\"ts\":%.3f,\"name\":\"deck\",\"args\":{\"drive\":%d,\"position\":%u}}",
+             ts, e.a == 1 ? 1 : (e.a == 2 ? -1 : 0), e.b);
+      break;
+    }
+  }
+  if (lastState)
+  {
+    double s = lastState->us - t0;
+    printf(",\n{\"ph\":\"X\",\"pid\":1,\"tid\":%d,\"ts\":%.3f,\"dur\":%.3f,\"name\":\"%s\"}", STATE_TRACK, s, tEnd - s,
+           lastState->a < states.size() ? states[lastState->a].c_str() : "?");
+  }
+  printf("\n]}\n");
+  fprintf(stderr, "%zu events, %.1f ms\n", events.size(), tEnd / 1000.0);
+  return 0;
+}
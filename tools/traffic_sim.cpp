@@ -0,0 +1,88 @@
+// Stochastic traffic simulator for the bridge policy. Runs the unmodified
+// firmware (src/main.cpp) in virtual time against a simulated waterway and
+// road, and reports the KPIs operations track, per simulated day.
+//
+//   g++ -std=c++17 -O2 -Ihost tools/traffic_sim.cpp -o traffic_sim -pthread
+//   ./traffic_sim --days 3 --boats-per-hour 6 --arrivals bursty
+//
+// Options:
+//   --days N             simulated days (default 1)
+//   --day-hours H        length of a "day" in hours (default 24)
+//   --seed N             RNG seed (default 1)
+//   --arrivals M         poisson | bursty (default poisson)
+//   --boats-per-hour R   mean boat arrival rate, both directions (default 4)
+//   --burst-size K       bursty: mean boats per burst (default 3)
+//   --burst-gap-s S      bursty: mean spacing inside a burst (default 20)
+//   --speed-cms A:B      boat speed range, cm/s (default 8:20)
+//   --length-cm A:B      boat length range, cm (default 20:50)
+//   --cars-per-hour R    mean road demand (default 300)
+//   --rush-hour X        road demand at the 08:00 and 17:00 peaks as a multiple
+//                        of the off-peak rate, 1 = flat (default 2)
+//   --false-echo P       chance a ping returns a spurious close echo (default 0)
+//   --sensor-x X         sensors at -X and +X along the channel (default 60)
+//   --stop-x X           stop lines at -X and +X (default 30)
+//   --csv                one CSV row per day instead of the table
+//
+// The traffic model and the KPI definitions are described in
+// tools/traffic_sim.h.
+#include "traffic_sim.h"
+
+int main(int argc, char **argv)
+{
+  SimConfig cfg;
+  bool csv = false;
+  for (int i = 1; i < argc; i++)
+  {
+    std::string a = argv[i];
+    const char *v = i + 1 < argc ? argv[i + 1] : "";
+    int r = parseSimOption(a, v, cfg, i);
+    bool ok = r > 0;
+    if (r == 0 && a == "--csv")
+      ok = true, csv = true;
+    if (!ok)
+    {
+      fprintf(stderr, "bad option %s %s\n", a.c_str(), v);
+      return 1;
+    }
+  }
+  if (!validSimConfig(cfg))
+    return 1;
+
+  TrafficSim sim(cfg);
+  sim.begin();
+
+  if (csv)
+    printf("day,boats,road_closed_min,boat_wait_mean_s,boat_wait_p95_s,boat_wait_max_s,openings_h,false_open,conflicts,"
+           "cars,cars_delayed,car_delay_mean_s\n");
+  else
+    printf("%4s %6s %9s %10s %9s %9s %10s %10s %9s %7s %8s %10s\n", "day", "boats", "road_min", "wait_mean",
+           "wait_p95", "wait_max", "openings_h", "false_open", "conflicts", "cars", "delayed", "car_delay");
+
+  std::vector<double> allWaits;
+  DayKpi total;
+  for (int d = 1; d <= cfg.days; d++)
+  {
+    DayKpi k = sim.runDay();
+    const char *fmt = csv ? "%d,%zu,%.1f,%.1f,%.1f,%.1f,%.2f,%d,%d,%ld,%ld,%.2f\n"
+                          : "%4d %6zu %9.1f %10.1f %9.1f %9.1f %10.2f %10d %9d %7ld %8ld %10.2f\n";
+    printf(fmt, d, k.waitsS.size(), k.roadClosedMs / 60000.0, mean(k.waitsS), percentile(k.waitsS, 0.95),
+           percentile(k.waitsS, 1.0),
+           k.openings / cfg.dayHours, k.falseOpenings, k.conflicts, k.cars, k.carsDelayed,
+           k.cars ? k.carDelayS / k.cars : 0.0);
+    allWaits.insert(allWaits.end(), k.waitsS.begin(), k.waitsS.end());
+    total.roadClosedMs += k.roadClosedMs;
+    total.openings += k.openings;
+    total.falseOpenings += k.falseOpenings;
+    total.conflicts += k.conflicts;
+    total.cars += k.cars;
+    total.carsDelayed += k.carsDelayed;
+    total.carDelayS += k.carDelayS;
+  }
+  if (!csv && cfg.days > 1)
+    printf("%4s %6zu %9.1f %10.1f %9.1f %9.1f %10.2f %10d %9d %7ld %8ld %10.2f\n", "all", allWaits.size(),
+           total.roadClosedMs / 60000.0 / cfg.days, mean(allWaits), percentile(allWaits, 0.95),
+           percentile(allWaits, 1.0),
+           total.openings / (cfg.dayHours * cfg.days), total.falseOpenings, total.conflicts, total.cars,
+           total.carsDelayed, total.cars ? total.carDelayS / total.cars : 0.0);
+  return 0;
+}
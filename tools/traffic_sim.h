@@ -0,0 +1,381 @@
+// Simulated waterway and road for the host build of the firmware. Drives the
+// unmodified control loop (src/main.cpp, included below) in virtual time and
+// collects the bridge KPIs. Used by tools/traffic_sim.cpp and
+// tools/policy_sweep.cpp. The firmware is a single instance per process, so
+// so is TrafficSim.
+//
+// Waterway (model scale, cm along the channel, bridge at 0):
+//
+//   -200 ... A(-60) ... stop(-30) [deck -15..15] stop(+30) ... B(+60) ... +200
+//
+// Sensors A and B look across the channel. A ping reads the lateral distance
+// to a hull covering the sensor's position, or no echo. Boats stop with their
+// bow at the stop line until the boat lamp is green, then go through; a bow
+// past the stop line is committed. Boats in the same direction queue with a
+// 10 cm gap.
+//
+// KPIs per day:
+//   road_closed_min  minutes the road lamp was not green
+//   boat_wait        seconds a boat lost to the bridge and the queue in front
+//                    of it, measured when its bow passes the stop line
+//                    (mean, p95, max; boats that never slowed count as 0).
+//                    A short boat held at the stop line can sit outside the
+//                    sensor beam; the max column shows such strandings.
+//   openings_h       bridge openings per hour
+//   false_open       openings during which no boat went under the deck
+//   conflicts        boats on the deck span while the deck was not fully open
+//   car_delay        seconds road vehicles waited at the closed road (mean
+//                    over all vehicles; vehicles delayed as a count)
+#pragma once
+
+#include "../src/main.cpp"
+
+#include <algorithm>
+#include <cmath>
+#include <random>
+#include <string>
+#include <vector>
+
+const float DECK_X = 15; // deck spans -DECK_X..DECK_X
+const float SPAWN_X = 200;
+const float BOAT_GAP = 10;
+
+struct SimConfig
+{
+  int days = 1;
+  double dayHours = 24;
+  uint32_t seed = 1;
+  bool bursty = false;
+  double boatsPerHour = 4;
+  double burstSize = 3;
+  double burstGapS = 20;
+  float speedMin = 8, speedMax = 20;
+  float lengthMin = 20, lengthMax = 50;
+  double carsPerHour = 300;
+  double rushHour = 2;
+  double falseEcho = 0;
+  float sensorX = 60;
+  float stopX = 30;
+};
+
+struct Boat
+{
+  int dir;           // +1 moves A -> B, -1 moves B -> A
+  float bow;         // x of the bow
+  float length;
+  float speed;       // cm/s
+  float lane;        // lateral distance from the sensors, cm
+  bool committed;    // bow is past its stop line
+  unsigned long spawnMs;
+  float spawnAlong;  // bow position along dir at spawn
+  bool underDeck;    // already counted as a passage
+};
+
+struct DayKpi
+{
+  double roadClosedMs = 0;
+  std::vector<double> waitsS;
+  int openings = 0;
+  int falseOpenings = 0;
+  int conflicts = 0;
+  long cars = 0;
+  long carsDelayed = 0;
+  double carDelayS = 0;
+};
+
+class TrafficSim
+{
+public:
+  explicit TrafficSim(const SimConfig &c) : cfg_(c), rng_(c.seed) {}
+
+  // Virtual-time boot of the firmware with the sensors wired to this world
+  void begin()
+  {
+    hostVirtualTime = true;
+    hostSerialQuiet = true;
+    hostWiFiConnectMs = -1; // no access point: no server thread, nothing else touches the globals
+    hostEchoModel = [this](int pin) { return echo(pin); };
+    setup();
+    lastMs_ = millis();
+    nextBoatMs_ = lastMs_ + drawBoatGapMs();
+    nextCarMs_ = lastMs_ + drawCarGapMs(lastMs_);
+  }
+
+  DayKpi runDay()
+  {
+    DayKpi k;
+    kpi_ = &k;
+    unsigned long end = lastMs_ + (unsigned long)(cfg_.dayHours * 3600000.0);
+    while (millis() < end)
+    {
+      loop();
+      step(millis());
+    }
+    // Boats still waiting at midnight report what they have lost so far
+    for (auto &b : boats_)
+      if (!b.committed)
+        k.waitsS.push_back(lostS(b, millis()));
+    kpi_ = nullptr;
+    return k;
+  }
+
+private:
+  double uniform(double a, double b) { return std::uniform_real_distribution<double>(a, b)(rng_); }
+  double expo(double mean) { return std::exponential_distribution<double>(1.0 / mean)(rng_); }
+
+  unsigned long drawBoatGapMs()
+  {
+    double meanGapMs = 3600000.0 / cfg_.boatsPerHour;
+    if (!cfg_.bursty)
+      return (unsigned long)expo(meanGapMs);
+    // Bursts arrive as a Poisson process; each holds a geometric number of
+    // boats spaced burstGapS apart on average, so the mean rate is unchanged
+    if (burstLeft_ > 0)
+    {
+      burstLeft_--;
+      return (unsigned long)expo(cfg_.burstGapS * 1000.0);
+    }
+    burstLeft_ = std::geometric_distribution<int>(1.0 / cfg_.burstSize)(rng_);
+    return (unsigned long)expo(meanGapMs * cfg_.burstSize);
+  }
+
+  // Road demand: an off-peak base plus two one-hour-wide rush-hour peaks
+  // (08:00, 17:00), scaled so the daily mean is carsPerHour
+  double carShape(unsigned long ms) const
+  {
+    double h = fmod(ms / 3600000.0, cfg_.dayHours) * 24.0 / cfg_.dayHours;
+    double peak = exp(-pow(h - 8, 2) / 2) + exp(-pow(h - 17, 2) / 2);
+    return 1 + (cfg_.rushHour - 1) * peak;
+  }
+
+  double carRate(unsigned long ms) const
+  {
+    const double meanPeak = 2 * sqrt(2 * M_PI) / 24; // daily mean of the two peaks
+    return cfg_.carsPerHour * carShape(ms) / (1 + (cfg_.rushHour - 1) * meanPeak);
+  }
+
+  // Next arrival of the non-homogeneous Poisson process, by thinning
+  unsigned long drawCarGapMs(unsigned long now)
+  {
+    if (cfg_.carsPerHour <= 0)
+      return ~0UL / 2;
+    double maxRate = carRate(0) * std::max(1.0, cfg_.rushHour) / carShape(0) * 1.01;
+    double t = now;
+    for (;;)
+    {
+      t += expo(3600000.0 / maxRate);
+      if (uniform(0, 1) * maxRate <= carRate((unsigned long)t))
+        return (unsigned long)(t - now);
+    }
+  }
+
+  void spawnBoat()
+  {
+    Boat b;
+    b.dir = uniform(0, 1) < 0.5 ? 1 : -1;
+    b.length = (float)uniform(cfg_.lengthMin, cfg_.lengthMax);
+    b.speed = (float)uniform(cfg_.speedMin, cfg_.speedMax);
+    b.lane = b.dir > 0 ? (float)uniform(15, 30) : (float)uniform(30, 45);
+    b.bow = -b.dir * SPAWN_X;
+    b.committed = false;
+    b.underDeck = false;
+    // Enter behind the last boat in the same direction
+    for (auto &o : boats_)
+      if (o.dir == b.dir && o.bow * b.dir - o.length - b.bow * b.dir < BOAT_GAP)
+        b.bow = (o.bow * b.dir - o.length - BOAT_GAP) * b.dir;
+    b.spawnMs = lastMs_;
+    b.spawnAlong = b.bow * b.dir;
+    boats_.push_back(b);
+  }
+
+  // Time lost against free flow from spawn to the stop line
+  double lostS(const Boat &b, unsigned long now) const
+  {
+    double freeS = (-cfg_.stopX - b.spawnAlong) / b.speed;
+    return std::max(0.0, (now - b.spawnMs) / 1000.0 - freeS);
+  }
+
+  unsigned long echo(int pin)
+  {
+    float x = pin == echoPin_A ? -cfg_.sensorX : cfg_.sensorX;
+    float best = 0;
+    for (auto &b : boats_)
+    {
+      float tail = b.bow - b.dir * b.length;
+      if ((x - b.bow) * (x - tail) <= 0 && (best == 0 || b.lane < best))
+        best = b.lane;
+    }
+    if (best == 0 && cfg_.falseEcho > 0 && uniform(0, 1) < cfg_.falseEcho)
+      best = (float)uniform(5, 50);
+    return best > 0 ? (unsigned long)(best * 2.0f / 0.034f) : 0;
+  }
+
+  void step(unsigned long now)
+  {
+    double dtMs = (double)(now - lastMs_);
+    lastMs_ = now;
+    DayKpi &k = *kpi_;
+
+    // Bridge cycle bookkeeping
+    if (currentState == BRIDGE_OPENING && lastState_ != BRIDGE_OPENING)
+    {
+      k.openings++;
+      cyclePassages_ = 0;
+      inCycle_ = true;
+    }
+    if (currentState == IDLE && lastState_ != IDLE && inCycle_)
+    {
+      if (cyclePassages_ == 0)
+        k.falseOpenings++;
+      inCycle_ = false;
+    }
+    lastState_ = currentState;
+
+    // Road
+    bool roadGreen = roadLamps[2].pattern().lit();
+    if (!roadGreen)
+      k.roadClosedMs += dtMs;
+    while (nextCarMs_ <= now)
+    {
+      k.cars++;
+      if (!roadGreen)
+        queuedCars_.push_back(nextCarMs_);
+      nextCarMs_ += drawCarGapMs(nextCarMs_);
+    }
+    if (roadGreen && !queuedCars_.empty())
+    {
+      for (unsigned long t : queuedCars_)
+        k.carDelayS += (now - t) / 1000.0;
+      k.carsDelayed += queuedCars_.size();
+      queuedCars_.clear();
+    }
+
+    // Waterway
+    while (nextBoatMs_ <= now)
+    {
+      spawnBoat();
+      nextBoatMs_ += drawBoatGapMs();
+    }
+    bool green = boatLamps[2].pattern().lit();
+    bool deckOpen = deck.position() == DECK_OPEN && !deck.moving();
+    // Lead boats first so followers see where the boat ahead ended up
+    std::sort(boats_.begin(), boats_.end(), [](const Boat &a, const Boat &b) { return a.bow * a.dir > b.bow * b.dir; });
+    for (size_t i = 0; i < boats_.size(); i++)
+    {
+      Boat &b = boats_[i];
+      float along = b.bow * b.dir; // progress along this boat's direction
+      float limit = SPAWN_X * 2;
+      if (!b.committed && !green)
+        limit = -cfg_.stopX;
+      for (size_t j = 0; j < i; j++)
+        if (boats_[j].dir == b.dir)
+          limit = std::min(limit, boats_[j].bow * b.dir - boats_[j].length - BOAT_GAP);
+      float next = std::min(along + b.speed * (float)dtMs / 1000.0f, std::max(along, limit));
+      b.bow = next * b.dir;
+      if (!b.committed && next > -cfg_.stopX)
+      {
+        b.committed = true;
+        // Credit the part of this step spent beyond the line
+        unsigned long crossMs = now - (unsigned long)((next + cfg_.stopX) / b.speed * 1000.0f);
+        k.waitsS.push_back(lostS(b, crossMs));
+      }
+      // Hull over the deck span
+      float tail = b.bow - b.dir * b.length;
+      bool over = std::max(b.bow, tail) > -DECK_X && std::min(b.bow, tail) < DECK_X;
+      if (over && !b.underDeck)
+      {
+        b.underDeck = true;
+        cyclePassages_++;
+        if (!deckOpen)
+          k.conflicts++;
+      }
+    }
+    boats_.erase(std::remove_if(boats_.begin(), boats_.end(),
+                                [](const Boat &b) { return (b.bow - b.dir * b.length) * b.dir > SPAWN_X; }),
+                 boats_.end());
+  }
+
+  SimConfig cfg_;
+  std::mt19937 rng_;
+  DayKpi *kpi_ = nullptr;
+  std::vector<Boat> boats_;
+  std::vector<unsigned long> queuedCars_;
+  unsigned long lastMs_ = 0;
+  unsigned long nextBoatMs_ = 0;
+  unsigned long nextCarMs_ = 0;
+  int burstLeft_ = 0;
+  MotorState lastState_ = IDLE;
+  bool inCycle_ = false;
+  int cyclePassages_ = 0;
+};
+
+inline double percentile(std::vector<double> v, double p)
+{
+  if (v.empty())
+    return 0;
+  std::sort(v.begin(), v.end());
+  size_t i = (size_t)std::ceil(p * v.size()) - 1;
+  return v[std::min(i, v.size() - 1)];
+}
+
+inline double mean(const std::vector<double> &v)
+{
+  double s = 0;
+  for (double x : v)
+    s += x;
+  return v.empty() ? 0 : s / v.size();
+}
+
+inline bool parseRange(const char *s, float &a, float &b)
+{
+  return sscanf(s, "%f:%f", &a, &b) == 2 && a > 0 && b >= a;
+}
+
+// Shared traffic options (see tools/traffic_sim.cpp). Returns 1 if argv[i]
+// was one of them (i then points at its last argument), 0 if not, -1 if its
+// value is bad.
+inline int parseSimOption(const std::string &a, const char *v, SimConfig &cfg, int &i)
+{
+  bool ok = true;
+  if (a == "--days")
+    cfg.days = atoi(v), i++;
+  else if (a == "--day-hours")
+    cfg.dayHours = atof(v), i++;
+  else if (a == "--seed")
+    cfg.seed = (uint32_t)strtoul(v, nullptr, 10), i++;
+  else if (a == "--arrivals")
+    ok = (cfg.bursty = std::string(v) == "bursty") || std::string(v) == "poisson", i++;
+  else if (a == "--boats-per-hour")
+    cfg.boatsPerHour = atof(v), i++;
+  else if (a == "--burst-size")
+    cfg.burstSize = atof(v), i++;
+  else if (a == "--burst-gap-s")
+    cfg.burstGapS = atof(v), i++;
+  else if (a == "--speed-cms")
+    ok = parseRange(v, cfg.speedMin, cfg.speedMax), i++;
+  else if (a == "--length-cm")
+    ok = parseRange(v, cfg.lengthMin, cfg.lengthMax), i++;
+  else if (a == "--cars-per-hour")
+    cfg.carsPerHour = atof(v), i++;
+  else if (a == "--rush-hour")
+    cfg.rushHour = atof(v), i++;
+  else if (a == "--false-echo")
+    cfg.falseEcho = atof(v), i++;
+  else if (a == "--sensor-x")
+    cfg.sensorX = (float)atof(v), i++;
+  else if (a == "--stop-x")
+    cfg.stopX = (float)atof(v), i++;
+  else
+    return 0;
+  return ok ? 1 : -1;
+}
+
+inline bool validSimConfig(const SimConfig &cfg)
+{
+  if (cfg.days >= 1 && cfg.dayHours > 0 && cfg.boatsPerHour > 0 && cfg.burstSize >= 1 &&
+      cfg.stopX > DECK_X && cfg.sensorX > 0 && cfg.sensorX < SPAWN_X)
+    return true;
+  fprintf(stderr, "days, day-hours and boats-per-hour must be positive, burst-size >= 1, "
+                  "deck < stop-x, 0 < sensor-x < %.0f\n", SPAWN_X);
+  return false;
+}